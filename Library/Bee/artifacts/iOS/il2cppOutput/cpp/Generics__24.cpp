@@ -22477,6 +22477,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR float DynamicHeightVirtualizationController_1
 	memset((&V_7), 0, sizeof(V_7));
 	bool V_8 = false;
 	bool V_9 = false;
+	float V_10 = 0.0f;
 	int32_t G_B5_0 = 0;
 	float G_B12_0 = 0.0f;
 	float G_B11_0 = 0.0f;
@@ -22546,51 +22547,53 @@ IL_004a:
 IL_0060:
 	{
 		V_2 = (0.0f);
-		int32_t L_11 = ___0_lastIndex;
-		V_6 = L_11;
+		float L_11;
+		L_11 = DynamicHeightVirtualizationController_1_get_defaultExpectedHeight_m4D61865B1BE6FD5E6D8C8C0FB2ABD8BAF6BF8B83(__this, il2cpp_rgctx_method(method->klass->rgctx_data, 28));
+		V_10 = L_11;
+		int32_t L_12 = ___0_lastIndex;
+		V_6 = L_12;
 		goto IL_00b5;
 	}
 
 IL_006b:
 	{
-		Dictionary_2_t4D7978E5F7E236382AF32684305AC72452D49043* L_12 = __this->___m_ContentHeightCache;
-		int32_t L_13 = V_6;
-		NullCheck(L_12);
-		bool L_14;
-		L_14 = Dictionary_2_TryGetValue_m860D445B386D5BA2AE21A6B60439EFC39B9E2A07(L_12, L_13, (&V_7), il2cpp_rgctx_method(method->klass->rgctx_data, 61));
-		V_8 = L_14;
-		bool L_15 = V_8;
-		if (!L_15)
+		Dictionary_2_t4D7978E5F7E236382AF32684305AC72452D49043* L_13 = __this->___m_ContentHeightCache;
+		int32_t L_14 = V_6;
+		NullCheck(L_13);
+		bool L_15;
+		L_15 = Dictionary_2_TryGetValue_m860D445B386D5BA2AE21A6B60439EFC39B9E2A07(L_13, L_14, (&V_7), il2cpp_rgctx_method(method->klass->rgctx_data, 61));
+		V_8 = L_15;
+		bool L_16 = V_8;
+		if (!L_16)
 		{
 			goto IL_0094;
 		}
 	}
 	{
-		float L_16 = V_2;
-		int32_t L_17 = V_6;
-		float L_18;
-		L_18 = DynamicHeightVirtualizationController_1_U3CGetContentHeightForIndexU3Eg__GetContentHeightFromCachedHeightU7C69_0_m92968EC23B52DC6CCA87F3EDAB27320AD2A3AD29(__this, L_17, (&V_7), (&V_0), il2cpp_rgctx_method(method->klass->rgctx_data, 63));
-		V_4 = ((float)il2cpp_codegen_add(L_16, L_18));
+		float L_17 = V_2;
+		int32_t L_18 = V_6;
+		float L_19;
+		L_19 = DynamicHeightVirtualizationController_1_U3CGetContentHeightForIndexU3Eg__GetContentHeightFromCachedHeightU7C69_0_m92968EC23B52DC6CCA87F3EDAB27320AD2A3AD29(__this, L_18, (&V_7), (&V_0), il2cpp_rgctx_method(method->klass->rgctx_data, 63));
+		V_4 = ((float)il2cpp_codegen_add(L_17, L_19));
 		goto IL_00c8;
 	}
 
 IL_0094:
 	{
-		float L_19 = V_2;
-		U3CU3Ec__DisplayClass69_0_t5DBB4E6E0AF627C2BE585E6F2B665F2C5FF66E59 L_20 = V_0;
-		int32_t L_21 = L_20.___draggedIndex;
-		int32_t L_22 = V_6;
-		if ((((int32_t)L_21) == ((int32_t)L_22)))
+		float L_20 = V_2;
+		U3CU3Ec__DisplayClass69_0_t5DBB4E6E0AF627C2BE585E6F2B665F2C5FF66E59 L_21 = V_0;
+		int32_t L_22 = L_21.___draggedIndex;
+		int32_t L_23 = V_6;
+		if ((((int32_t)L_22) == ((int32_t)L_23)))
 		{
-			G_B12_0 = L_19;
+			G_B12_0 = L_20;
 			goto IL_00a7;
 		}
-		G_B11_0 = L_19;
+		G_B11_0 = L_20;
 	}
 	{
-		float L_23;
-		L_23 = DynamicHeightVirtualizationController_1_get_defaultExpectedHeight_m4D61865B1BE6FD5E6D8C8C0FB2ABD8BAF6BF8B83(__this, il2cpp_rgctx_method(method->klass->rgctx_data, 28));
-		G_B13_0 = L_23;
+		float L_24 = V_10;
+		G_B13_0 = L_24;
 		G_B13_1 = G_B11_0;
 		goto IL_00ac;
 	}
@@ -22604,30 +22607,30 @@ IL_00a7:
 IL_00ac:
 	{
 		V_2 = ((float)il2cpp_codegen_add(G_B13_1, G_B13_0));
-		int32_t L_24 = V_6;
-		V_6 = ((int32_t)il2cpp_codegen_subtract(L_24, 1));
+		int32_t L_25 = V_6;
+		V_6 = ((int32_t)il2cpp_codegen_subtract(L_25, 1));
 	}
 
 IL_00b5:
 	{
-		int32_t L_25 = V_6;
-		V_9 = (bool)((((int32_t)((((int32_t)L_25) < ((int32_t)0))? 1 : 0)) == ((int32_t)0))? 1 : 0);
-		bool L_26 = V_9;
-		if (L_26)
+		int32_t L_26 = V_6;
+		V_9 = (bool)((((int32_t)((((int32_t)L_26) < ((int32_t)0))? 1 : 0)) == ((int32_t)0))? 1 : 0);
+		bool L_27 = V_9;
+		if (L_27)
 		{
 			goto IL_006b;
 		}
 	}
 	{
-		float L_27 = V_2;
-		V_4 = L_27;
+		float L_28 = V_2;
+		V_4 = L_28;
 		goto IL_00c8;
 	}
 
 IL_00c8:
 	{
-		float L_28 = V_4;
-		return L_28;
+		float L_29 = V_4;
+		return L_29;
 	}
 }
 IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR ContentHeightCacheInfo_tA616347D46981FC5684B6268FC7035C431E99FBC DynamicHeightVirtualizationController_1_GetCachedContentHeight_m716866FA9AFF1DB72BCD530FD78C785F250A9133_gshared (DynamicHeightVirtualizationController_1_t696B0520A1F69715F47A9EA13FC58101EF1B1F8C* __this, int32_t ___0_index, const RuntimeMethod* method) 
@@ -6593,6 +6593,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00
 	int32_t V_7 = 0;
 	TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* V_8 = NULL;
 	int32_t V_9 = 0;
+	Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* V_10 = NULL;
 	TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* G_B30_0 = NULL;
 	{
 		bool* L_0 = ___5_isAlternativeTypeface;
@@ -6820,6 +6821,7 @@ IL_00d6:
 		NullCheck(L_27);
 		Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* L_28;
 		L_28 = TMP_FontAsset_get_characterLookupTable_mEFAADDFAA6233DFEC3A0D8C163588B3C678451E9(L_27, NULL);
+		V_10 = L_28;
 		uint32_t L_29 = ___0_unicode;
 		NullCheck(L_28);
 		bool L_30;
@@ -6851,33 +6853,30 @@ IL_00d6:
 
 IL_0107:
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_36 = V_4;
+		Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* L_36 = V_10;
+		uint32_t L_37 = ___0_unicode;
 		NullCheck(L_36);
-		Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* L_37;
-		L_37 = TMP_FontAsset_get_characterLookupTable_mEFAADDFAA6233DFEC3A0D8C163588B3C678451E9(L_36, NULL);
-		uint32_t L_38 = ___0_unicode;
-		NullCheck(L_37);
-		bool L_39;
-		L_39 = Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64(L_37, L_38, Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64_RuntimeMethod_var);
+		bool L_38;
+		L_38 = Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64(L_36, L_37, Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64_RuntimeMethod_var);
 	}
 
 IL_0115:
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_40 = V_4;
-		NullCheck(L_40);
-		int32_t L_41;
-		L_41 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_40, NULL);
-		if ((((int32_t)L_41) == ((int32_t)1)))
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_39 = V_4;
+		NullCheck(L_39);
+		int32_t L_40;
+		L_40 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_39, NULL);
+		if ((((int32_t)L_40) == ((int32_t)1)))
 		{
 			goto IL_0129;
 		}
 	}
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_42 = V_4;
-		NullCheck(L_42);
-		int32_t L_43;
-		L_43 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_42, NULL);
-		if ((!(((uint32_t)L_43) == ((uint32_t)2))))
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_41 = V_4;
+		NullCheck(L_41);
+		int32_t L_42;
+		L_42 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_41, NULL);
+		if ((!(((uint32_t)L_42) == ((uint32_t)2))))
 		{
 			goto IL_013b;
 		}
@@ -6885,85 +6884,83 @@ IL_0115:
 
 IL_0129:
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_44 = V_4;
-		uint32_t L_45 = ___0_unicode;
-		NullCheck(L_44);
-		bool L_46;
-		L_46 = TMP_FontAsset_TryAddCharacterInternal_m95DD37F41C18EE7692B44DCD984CD12C2350C122(L_44, L_45, (&V_0), NULL);
-		if (!L_46)
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_43 = V_4;
+		uint32_t L_44 = ___0_unicode;
+		NullCheck(L_43);
+		bool L_45;
+		L_45 = TMP_FontAsset_TryAddCharacterInternal_m95DD37F41C18EE7692B44DCD984CD12C2350C122(L_43, L_44, (&V_0), NULL);
+		if (!L_45)
 		{
 			goto IL_013b;
 		}
 	}
 	{
-		bool* L_47 = ___5_isAlternativeTypeface;
-		*((int8_t*)L_47) = (int8_t)1;
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_48 = V_0;
-		return L_48;
+		bool* L_46 = ___5_isAlternativeTypeface;
+		*((int8_t*)L_46) = (int8_t)1;
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_47 = V_0;
+		return L_47;
 	}
 
 IL_013b:
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_49 = ___1_sourceFontAsset;
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_48 = ___1_sourceFontAsset;
+		NullCheck(L_48);
+		Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* L_49;
+		L_49 = TMP_FontAsset_get_characterLookupTable_mEFAADDFAA6233DFEC3A0D8C163588B3C678451E9(L_48, NULL);
+		V_10 = L_49;
+		uint32_t L_50 = ___0_unicode;
 		NullCheck(L_49);
-		Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* L_50;
-		L_50 = TMP_FontAsset_get_characterLookupTable_mEFAADDFAA6233DFEC3A0D8C163588B3C678451E9(L_49, NULL);
-		uint32_t L_51 = ___0_unicode;
-		NullCheck(L_50);
-		bool L_52;
-		L_52 = Dictionary_2_TryGetValue_mE5BE2B2AA15D82376D24682A93BC1E4BB758420C(L_50, L_51, (&V_0), Dictionary_2_TryGetValue_mE5BE2B2AA15D82376D24682A93BC1E4BB758420C_RuntimeMethod_var);
-		if (!L_52)
+		bool L_51;
+		L_51 = Dictionary_2_TryGetValue_mE5BE2B2AA15D82376D24682A93BC1E4BB758420C(L_49, L_50, (&V_0), Dictionary_2_TryGetValue_mE5BE2B2AA15D82376D24682A93BC1E4BB758420C_RuntimeMethod_var);
+		if (!L_51)
 		{
 			goto IL_0168;
 		}
 	}
 	{
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_53 = V_0;
-		NullCheck(L_53);
-		TMP_Asset_t135A047D4F5CBBA9CD356B762B55AB164122B969* L_54;
-		L_54 = TMP_TextElement_get_textAsset_m3FFA01E6D0068D1F8F578CBF2590A752683A61EA_inline(L_53, NULL);
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_52 = V_0;
+		NullCheck(L_52);
+		TMP_Asset_t135A047D4F5CBBA9CD356B762B55AB164122B969* L_53;
+		L_53 = TMP_TextElement_get_textAsset_m3FFA01E6D0068D1F8F578CBF2590A752683A61EA_inline(L_52, NULL);
 		il2cpp_codegen_runtime_class_init_inline(Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C_il2cpp_TypeInfo_var);
-		bool L_55;
-		L_55 = Object_op_Inequality_mD0BE578448EAA61948F25C32F8DD55AB1F778602(L_54, (Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C*)NULL, NULL);
-		if (!L_55)
+		bool L_54;
+		L_54 = Object_op_Inequality_mD0BE578448EAA61948F25C32F8DD55AB1F778602(L_53, (Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C*)NULL, NULL);
+		if (!L_54)
 		{
 			goto IL_015b;
 		}
 	}
 	{
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_56 = V_0;
-		return L_56;
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_55 = V_0;
+		return L_55;
 	}
 
 IL_015b:
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_57 = ___1_sourceFontAsset;
-		NullCheck(L_57);
-		Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* L_58;
-		L_58 = TMP_FontAsset_get_characterLookupTable_mEFAADDFAA6233DFEC3A0D8C163588B3C678451E9(L_57, NULL);
-		uint32_t L_59 = ___0_unicode;
-		NullCheck(L_58);
-		bool L_60;
-		L_60 = Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64(L_58, L_59, Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64_RuntimeMethod_var);
+		Dictionary_2_tCB5FEF8D6CEA1557D9B9BA25946AD6BF3E6C14D0* L_56 = V_10;
+		uint32_t L_57 = ___0_unicode;
+		NullCheck(L_56);
+		bool L_58;
+		L_58 = Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64(L_56, L_57, Dictionary_2_Remove_m33738F480A51A3D2039C0714C57F7432B684DA64_RuntimeMethod_var);
 	}
 
 IL_0168:
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_61 = ___1_sourceFontAsset;
-		NullCheck(L_61);
-		int32_t L_62;
-		L_62 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_61, NULL);
-		if ((((int32_t)L_62) == ((int32_t)1)))
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_59 = ___1_sourceFontAsset;
+		NullCheck(L_59);
+		int32_t L_60;
+		L_60 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_59, NULL);
+		if ((((int32_t)L_60) == ((int32_t)1)))
 		{
 			goto IL_017a;
 		}
 	}
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_63 = ___1_sourceFontAsset;
-		NullCheck(L_63);
-		int32_t L_64;
-		L_64 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_63, NULL);
-		if ((!(((uint32_t)L_64) == ((uint32_t)2))))
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_61 = ___1_sourceFontAsset;
+		NullCheck(L_61);
+		int32_t L_62;
+		L_62 = TMP_FontAsset_get_atlasPopulationMode_m31A707178FB4F1722BA7D090A8E169CE2FAEB19F_inline(L_61, NULL);
+		if ((!(((uint32_t)L_62) == ((uint32_t)2))))
 		{
 			goto IL_0187;
 		}
@@ -6971,53 +6968,53 @@ IL_0168:
 
 IL_017a:
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_65 = ___1_sourceFontAsset;
-		uint32_t L_66 = ___0_unicode;
-		NullCheck(L_65);
-		bool L_67;
-		L_67 = TMP_FontAsset_TryAddCharacterInternal_m95DD37F41C18EE7692B44DCD984CD12C2350C122(L_65, L_66, (&V_0), NULL);
-		if (!L_67)
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_63 = ___1_sourceFontAsset;
+		uint32_t L_64 = ___0_unicode;
+		NullCheck(L_63);
+		bool L_65;
+		L_65 = TMP_FontAsset_TryAddCharacterInternal_m95DD37F41C18EE7692B44DCD984CD12C2350C122(L_63, L_64, (&V_0), NULL);
+		if (!L_65)
 		{
 			goto IL_0187;
 		}
 	}
 	{
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_68 = V_0;
-		return L_68;
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_66 = V_0;
+		return L_66;
 	}
 
 IL_0187:
 	{
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_69 = V_0;
-		bool L_70 = ___2_includeFallbacks;
-		if (!((int32_t)(((((RuntimeObject*)(TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35*)L_69) == ((RuntimeObject*)(RuntimeObject*)NULL))? 1 : 0)&(int32_t)L_70)))
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_67 = V_0;
+		bool L_68 = ___2_includeFallbacks;
+		if (!((int32_t)(((((RuntimeObject*)(TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35*)L_67) == ((RuntimeObject*)(RuntimeObject*)NULL))? 1 : 0)&(int32_t)L_68)))
 		{
 			goto IL_01ff;
 		}
 	}
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_71 = ___1_sourceFontAsset;
-		NullCheck(L_71);
-		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_72;
-		L_72 = TMP_FontAsset_get_fallbackFontAssetTable_mE0C2D8D8A55C5E2FAAB13CE0A5591C82F1AAF15A_inline(L_71, NULL);
-		if (!L_72)
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_69 = ___1_sourceFontAsset;
+		NullCheck(L_69);
+		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_70;
+		L_70 = TMP_FontAsset_get_fallbackFontAssetTable_mE0C2D8D8A55C5E2FAAB13CE0A5591C82F1AAF15A_inline(L_69, NULL);
+		if (!L_70)
 		{
 			goto IL_01ff;
 		}
 	}
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_73 = ___1_sourceFontAsset;
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_71 = ___1_sourceFontAsset;
+		NullCheck(L_71);
+		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_72;
+		L_72 = TMP_FontAsset_get_fallbackFontAssetTable_mE0C2D8D8A55C5E2FAAB13CE0A5591C82F1AAF15A_inline(L_71, NULL);
+		V_5 = L_72;
+		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_73 = V_5;
 		NullCheck(L_73);
-		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_74;
-		L_74 = TMP_FontAsset_get_fallbackFontAssetTable_mE0C2D8D8A55C5E2FAAB13CE0A5591C82F1AAF15A_inline(L_73, NULL);
-		V_5 = L_74;
-		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_75 = V_5;
-		NullCheck(L_75);
-		int32_t L_76;
-		L_76 = List_1_get_Count_m1CD49ABC19C33C9320E4E745DFBF7CC6D1E5A899_inline(L_75, List_1_get_Count_m1CD49ABC19C33C9320E4E745DFBF7CC6D1E5A899_RuntimeMethod_var);
-		V_6 = L_76;
-		int32_t L_77 = V_6;
-		if (L_77)
+		int32_t L_74;
+		L_74 = List_1_get_Count_m1CD49ABC19C33C9320E4E745DFBF7CC6D1E5A899_inline(L_73, List_1_get_Count_m1CD49ABC19C33C9320E4E745DFBF7CC6D1E5A899_RuntimeMethod_var);
+		V_6 = L_74;
+		int32_t L_75 = V_6;
+		if (L_75)
 		{
 			goto IL_01ae;
 		}
@@ -7034,70 +7031,70 @@ IL_01ae:
 
 IL_01b3:
 	{
-		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_78 = V_5;
-		int32_t L_79 = V_7;
-		NullCheck(L_78);
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_80;
-		L_80 = List_1_get_Item_m08FA6F29837845000B96D856290A41C30CE4A17E(L_78, L_79, List_1_get_Item_m08FA6F29837845000B96D856290A41C30CE4A17E_RuntimeMethod_var);
-		V_8 = L_80;
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_81 = V_8;
+		List_1_t06C3ABB0C6F2347B32881E33D154431EADAE3ECF* L_76 = V_5;
+		int32_t L_77 = V_7;
+		NullCheck(L_76);
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_78;
+		L_78 = List_1_get_Item_m08FA6F29837845000B96D856290A41C30CE4A17E(L_76, L_77, List_1_get_Item_m08FA6F29837845000B96D856290A41C30CE4A17E_RuntimeMethod_var);
+		V_8 = L_78;
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_79 = V_8;
 		il2cpp_codegen_runtime_class_init_inline(Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C_il2cpp_TypeInfo_var);
-		bool L_82;
-		L_82 = Object_op_Equality_mB6120F782D83091EF56A198FCEBCF066DB4A9605(L_81, (Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C*)NULL, NULL);
-		if (L_82)
+		bool L_80;
+		L_80 = Object_op_Equality_mB6120F782D83091EF56A198FCEBCF066DB4A9605(L_79, (Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C*)NULL, NULL);
+		if (L_80)
 		{
 			goto IL_01f3;
 		}
 	}
 	{
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_83 = V_8;
-		NullCheck(L_83);
-		int32_t L_84;
-		L_84 = TMP_Asset_get_instanceID_mD7D5D79979B77457C3A376955C316AC289BB3D1D(L_83, NULL);
-		V_9 = L_84;
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_81 = V_8;
+		NullCheck(L_81);
+		int32_t L_82;
+		L_82 = TMP_Asset_get_instanceID_mD7D5D79979B77457C3A376955C316AC289BB3D1D(L_81, NULL);
+		V_9 = L_82;
 		il2cpp_codegen_runtime_class_init_inline(TMP_FontAssetUtilities_tE01A2EFABA32F807FBA80E9BBE26A1F3D5D25125_il2cpp_TypeInfo_var);
-		HashSet_1_t4A2F2B74276D0AD3ED0F873045BD61E9504ECAE2* L_85 = ((TMP_FontAssetUtilities_tE01A2EFABA32F807FBA80E9BBE26A1F3D5D25125_StaticFields*)il2cpp_codegen_static_fields_for(TMP_FontAssetUtilities_tE01A2EFABA32F807FBA80E9BBE26A1F3D5D25125_il2cpp_TypeInfo_var))->___k_SearchedAssets;
-		int32_t L_86 = V_9;
-		NullCheck(L_85);
-		bool L_87;
-		L_87 = HashSet_1_Add_m9B0DD9902395EE95D3DC522264BE1EBBBD3513EB(L_85, L_86, HashSet_1_Add_m9B0DD9902395EE95D3DC522264BE1EBBBD3513EB_RuntimeMethod_var);
-		if (!L_87)
+		HashSet_1_t4A2F2B74276D0AD3ED0F873045BD61E9504ECAE2* L_83 = ((TMP_FontAssetUtilities_tE01A2EFABA32F807FBA80E9BBE26A1F3D5D25125_StaticFields*)il2cpp_codegen_static_fields_for(TMP_FontAssetUtilities_tE01A2EFABA32F807FBA80E9BBE26A1F3D5D25125_il2cpp_TypeInfo_var))->___k_SearchedAssets;
+		int32_t L_84 = V_9;
+		NullCheck(L_83);
+		bool L_85;
+		L_85 = HashSet_1_Add_m9B0DD9902395EE95D3DC522264BE1EBBBD3513EB(L_83, L_84, HashSet_1_Add_m9B0DD9902395EE95D3DC522264BE1EBBBD3513EB_RuntimeMethod_var);
+		if (!L_85)
 		{
 			goto IL_01f3;
 		}
 	}
 	{
-		uint32_t L_88 = ___0_unicode;
-		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_89 = V_8;
-		int32_t L_90 = ___3_fontStyle;
-		int32_t L_91 = ___4_fontWeight;
-		bool* L_92 = ___5_isAlternativeTypeface;
+		uint32_t L_86 = ___0_unicode;
+		TMP_FontAsset_t923BF2F78D7C5AC36376E168A1193B7CB4855160* L_87 = V_8;
+		int32_t L_88 = ___3_fontStyle;
+		int32_t L_89 = ___4_fontWeight;
+		bool* L_90 = ___5_isAlternativeTypeface;
 		il2cpp_codegen_runtime_class_init_inline(TMP_FontAssetUtilities_tE01A2EFABA32F807FBA80E9BBE26A1F3D5D25125_il2cpp_TypeInfo_var);
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_93;
-		L_93 = TMP_FontAssetUtilities_GetCharacterFromFontAsset_Internal_m0275490A50962C94DBC85C431D4FB8D3117C2716(L_88, L_89, (bool)1, L_90, L_91, L_92, NULL);
-		V_0 = L_93;
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_94 = V_0;
-		if (!L_94)
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_91;
+		L_91 = TMP_FontAssetUtilities_GetCharacterFromFontAsset_Internal_m0275490A50962C94DBC85C431D4FB8D3117C2716(L_86, L_87, (bool)1, L_88, L_89, L_90, NULL);
+		V_0 = L_91;
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_92 = V_0;
+		if (!L_92)
 		{
 			goto IL_01f3;
 		}
 	}
 	{
-		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_95 = V_0;
-		return L_95;
+		TMP_Character_t7D37A55EF1A9FF6D0BFE6D50E86A00F80E7FAF35* L_93 = V_0;
+		return L_93;
 	}
 
 IL_01f3:
 	{
-		int32_t L_96 = V_7;
-		V_7 = ((int32_t)il2cpp_codegen_add(L_96, 1));
+		int32_t L_94 = V_7;
+		V_7 = ((int32_t)il2cpp_codegen_add(L_94, 1));
 	}
 
 IL_01f9:
 	{
-		int32_t L_97 = V_7;
-		int32_t L_98 = V_6;
-		if ((((int32_t)L_97) < ((int32_t)L_98)))
+		int32_t L_95 = V_7;
+		int32_t L_96 = V_6;
+		if ((((int32_t)L_95) < ((int32_t)L_96)))
 		{
 			goto IL_01b3;
 		}
@@ -9463,37 +9463,108 @@ IL_000c:
 IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void TMP_Text_SetText_m5DCA387D68F6109E1B86327384B249B6900BFDE2 (TMP_Text_tE8D677872D43AD4B2AAF0D6101692A17D0B251A9* __this, String_t* ___0_sourceText, const RuntimeMethod* method) 
 {
 	int32_t V_0 = 0;
-	int32_t G_B3_0 = 0;
+	int32_t G_B11_0 = 0;
 	{
-		String_t* L_0 = ___0_sourceText;
-		if (!L_0)
+		bool L_0 = __this->___m_IsTextBackingStringDirty;
+		if (L_0)
 		{
-			goto IL_000b;
+			goto IL_004e;
 		}
 	}
 	{
-		String_t* L_1 = ___0_sourceText;
-		NullCheck(L_1);
-		int32_t L_2;
-		L_2 = String_get_Length_m42625D67623FA5CC7A44D47425CE86FB946542D2_inline(L_1, NULL);
-		G_B3_0 = L_2;
-		goto IL_000c;
+		bool L_1 = __this->___m_havePropertiesChanged;
+		if (L_1)
+		{
+			goto IL_004e;
+		}
+	}
+	{
+		int32_t L_2 = __this->___m_inputSource;
+		if ((!(((uint32_t)L_2) == ((uint32_t)3))))
+		{
+			goto IL_004e;
+		}
+	}
+	{
+		TextProcessingElementU5BU5D_tC3E97D1672C8DB6E1F91DB2C0987D0ED9A2E7113* L_3 = __this->___m_TextProcessingArray;
+		if (!L_3)
+		{
+			goto IL_004e;
+		}
+	}
+	{
+		String_t* L_4 = __this->___m_text;
+		if (!L_4)
+		{
+			goto IL_004e;
+		}
+	}
+	{
+		String_t* L_5 = ___0_sourceText;
+		if (!L_5)
+		{
+			goto IL_004e;
+		}
+	}
+	{
+		String_t* L_6 = __this->___m_text;
+		NullCheck(L_6);
+		int32_t L_7;
+		L_7 = String_get_Length_m42625D67623FA5CC7A44D47425CE86FB946542D2_inline(L_6, NULL);
+		String_t* L_8 = ___0_sourceText;
+		NullCheck(L_8);
+		int32_t L_9;
+		L_9 = String_get_Length_m42625D67623FA5CC7A44D47425CE86FB946542D2_inline(L_8, NULL);
+		if ((!(((uint32_t)L_7) == ((uint32_t)L_9))))
+		{
+			goto IL_004e;
+		}
+	}
+	{
+		String_t* L_10 = __this->___m_text;
+		String_t* L_11 = ___0_sourceText;
+		bool L_12;
+		L_12 = String_op_Equality_m030E1B219352228970A076136E455C4E568C02C1(L_10, L_11, NULL);
+		if (!L_12)
+		{
+			goto IL_004e;
+		}
+	}
+	{
+		return;
 	}
 
-IL_000b:
+IL_004e:
 	{
-		G_B3_0 = 0;
+		String_t* L_13 = ___0_sourceText;
+		if (!L_13)
+		{
+			goto IL_0059;
+		}
+	}
+	{
+		String_t* L_14 = ___0_sourceText;
+		NullCheck(L_14);
+		int32_t L_15;
+		L_15 = String_get_Length_m42625D67623FA5CC7A44D47425CE86FB946542D2_inline(L_14, NULL);
+		G_B11_0 = L_15;
+		goto IL_005a;
 	}
 
-IL_000c:
+IL_0059:
 	{
-		V_0 = G_B3_0;
-		String_t* L_3 = ___0_sourceText;
-		int32_t L_4 = V_0;
-		TMP_Text_PopulateTextBackingArray_mDAFAFBA1D6EF883BBA870BEC34F4AFC52A8D4799(__this, L_3, 0, L_4, NULL);
-		String_t* L_5 = ___0_sourceText;
-		__this->___m_text = L_5;
-		Il2CppCodeGenWriteBarrier((void**)(&__this->___m_text), (void*)L_5);
+		G_B11_0 = 0;
+	}
+
+IL_005a:
+	{
+		V_0 = G_B11_0;
+		String_t* L_16 = ___0_sourceText;
+		int32_t L_17 = V_0;
+		TMP_Text_PopulateTextBackingArray_mDAFAFBA1D6EF883BBA870BEC34F4AFC52A8D4799(__this, L_16, 0, L_17, NULL);
+		String_t* L_18 = ___0_sourceText;
+		__this->___m_text = L_18;
+		Il2CppCodeGenWriteBarrier((void**)(&__this->___m_text), (void*)L_18);
 		__this->___m_inputSource = 3;
 		TMP_Text_PopulateTextProcessingArray_m2D1F8D3CAE8F1F29242547BCCC91D1226FA9A6F0(__this, NULL);
 		__this->___m_havePropertiesChanged = (bool)1;
@@ -19736,6 +19807,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void TMP_Text_FillCharacterVertexBuffers_m7B5
 	int32_t V_0 = 0;
 	int32_t V_1 = 0;
 	TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* V_2 = NULL;
+	TMP_MeshInfo_t320C52212E9D672EBB5F5C18C3E0700AA33DD76B* V_3 = NULL;
+	TMP_CharacterInfo_t8B8FF32D6AACE251F2E7835AA5BC6608D535D9F8* V_4 = NULL;
 	int32_t G_B4_0 = 0;
 	Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* G_B4_1 = NULL;
 	int32_t G_B3_0 = 0;
@@ -19815,205 +19888,107 @@ IL_0069:
 		NullCheck(L_18);
 		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_19 = L_18->___characterInfo;
 		V_2 = L_19;
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_20 = __this->___m_textInfo;
+		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_20 = V_2;
+		int32_t L_21 = ___0_i;
 		NullCheck(L_20);
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_21 = L_20->___characterInfo;
-		int32_t L_22 = ___0_i;
-		NullCheck(L_21);
-		int32_t L_23 = V_1;
-		((L_21)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_22)))->___vertexIndex = L_23;
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_24 = __this->___m_textInfo;
-		NullCheck(L_24);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_25 = L_24->___meshInfo;
-		int32_t L_26 = V_0;
-		NullCheck(L_25);
-		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_27 = ((L_25)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_26)))->___vertices;
+		V_4 = ((L_20)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_21)));
+		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_22 = __this->___m_textInfo;
+		NullCheck(L_22);
+		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_23 = L_22->___meshInfo;
+		int32_t L_24 = V_0;
+		NullCheck(L_23);
+		V_3 = ((L_23)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_24)));
+		TMP_CharacterInfo_t8B8FF32D6AACE251F2E7835AA5BC6608D535D9F8* L_25 = V_4;
+		int32_t L_26 = V_1;
+		L_25->___vertexIndex = L_26;
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_27 = V_3->___vertices;
 		int32_t L_28 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_29 = V_2;
-		int32_t L_30 = ___0_i;
-		NullCheck(L_29);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_31 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_29)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_30)))->___vertex_BL);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_32 = L_31->___position;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_29 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_30 = L_29->___position;
 		NullCheck(L_27);
-		(L_27)->SetAt(static_cast<il2cpp_array_size_t>(L_28), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_32);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_33 = __this->___m_textInfo;
-		NullCheck(L_33);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_34 = L_33->___meshInfo;
-		int32_t L_35 = V_0;
-		NullCheck(L_34);
-		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_36 = ((L_34)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_35)))->___vertices;
-		int32_t L_37 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_38 = V_2;
-		int32_t L_39 = ___0_i;
-		NullCheck(L_38);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_40 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_38)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_39)))->___vertex_TL);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_41 = L_40->___position;
-		NullCheck(L_36);
-		(L_36)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(1, L_37))), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_41);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_42 = __this->___m_textInfo;
-		NullCheck(L_42);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_43 = L_42->___meshInfo;
-		int32_t L_44 = V_0;
+		(L_27)->SetAt(static_cast<il2cpp_array_size_t>(L_28), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_30);
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_31 = V_3->___vertices;
+		int32_t L_32 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_33 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_34 = L_33->___position;
+		NullCheck(L_31);
+		(L_31)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(1, L_32))), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_34);
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_35 = V_3->___vertices;
+		int32_t L_36 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_37 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TR);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_38 = L_37->___position;
+		NullCheck(L_35);
+		(L_35)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(2, L_36))), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_38);
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_39 = V_3->___vertices;
+		int32_t L_40 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_41 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BR);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_42 = L_41->___position;
+		NullCheck(L_39);
+		(L_39)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(3, L_40))), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_42);
+		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_43 = V_3->___uvs0;
+		int32_t L_44 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_45 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BL);
+		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_46 = L_45->___uv;
 		NullCheck(L_43);
-		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_45 = ((L_43)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_44)))->___vertices;
-		int32_t L_46 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_47 = V_2;
-		int32_t L_48 = ___0_i;
+		(L_43)->SetAt(static_cast<il2cpp_array_size_t>(L_44), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_46);
+		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_47 = V_3->___uvs0;
+		int32_t L_48 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_49 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TL);
+		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_50 = L_49->___uv;
 		NullCheck(L_47);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_49 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_47)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_48)))->___vertex_TR);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_50 = L_49->___position;
-		NullCheck(L_45);
-		(L_45)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(2, L_46))), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_50);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_51 = __this->___m_textInfo;
+		(L_47)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(1, L_48))), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_50);
+		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_51 = V_3->___uvs0;
+		int32_t L_52 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_53 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TR);
+		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_54 = L_53->___uv;
 		NullCheck(L_51);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_52 = L_51->___meshInfo;
-		int32_t L_53 = V_0;
-		NullCheck(L_52);
-		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_54 = ((L_52)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_53)))->___vertices;
-		int32_t L_55 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_56 = V_2;
-		int32_t L_57 = ___0_i;
-		NullCheck(L_56);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_58 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_56)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_57)))->___vertex_BR);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_59 = L_58->___position;
-		NullCheck(L_54);
-		(L_54)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(3, L_55))), (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2)L_59);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_60 = __this->___m_textInfo;
-		NullCheck(L_60);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_61 = L_60->___meshInfo;
-		int32_t L_62 = V_0;
-		NullCheck(L_61);
-		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_63 = ((L_61)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_62)))->___uvs0;
+		(L_51)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(2, L_52))), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_54);
+		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_55 = V_3->___uvs0;
+		int32_t L_56 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_57 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BR);
+		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_58 = L_57->___uv;
+		NullCheck(L_55);
+		(L_55)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(3, L_56))), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_58);
+		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_59 = V_3->___uvs2;
+		int32_t L_60 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_61 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BL);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_62 = L_61->___uv2;
+		NullCheck(L_59);
+		(L_59)->SetAt(static_cast<il2cpp_array_size_t>(L_60), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_62);
+		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_63 = V_3->___uvs2;
 		int32_t L_64 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_65 = V_2;
-		int32_t L_66 = ___0_i;
-		NullCheck(L_65);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_67 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_65)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_66)))->___vertex_BL);
-		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_68 = L_67->___uv;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_65 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TL);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_66 = L_65->___uv2;
 		NullCheck(L_63);
-		(L_63)->SetAt(static_cast<il2cpp_array_size_t>(L_64), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_68);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_69 = __this->___m_textInfo;
-		NullCheck(L_69);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_70 = L_69->___meshInfo;
-		int32_t L_71 = V_0;
-		NullCheck(L_70);
-		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_72 = ((L_70)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_71)))->___uvs0;
-		int32_t L_73 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_74 = V_2;
-		int32_t L_75 = ___0_i;
-		NullCheck(L_74);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_76 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_74)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_75)))->___vertex_TL);
-		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_77 = L_76->___uv;
-		NullCheck(L_72);
-		(L_72)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(1, L_73))), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_77);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_78 = __this->___m_textInfo;
-		NullCheck(L_78);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_79 = L_78->___meshInfo;
-		int32_t L_80 = V_0;
-		NullCheck(L_79);
-		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_81 = ((L_79)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_80)))->___uvs0;
-		int32_t L_82 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_83 = V_2;
-		int32_t L_84 = ___0_i;
-		NullCheck(L_83);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_85 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_83)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_84)))->___vertex_TR);
-		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_86 = L_85->___uv;
-		NullCheck(L_81);
-		(L_81)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(2, L_82))), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_86);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_87 = __this->___m_textInfo;
-		NullCheck(L_87);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_88 = L_87->___meshInfo;
-		int32_t L_89 = V_0;
-		NullCheck(L_88);
-		Vector4U5BU5D_tC0F3A7115F85007510F6D173968200CD31BCF7AD* L_90 = ((L_88)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_89)))->___uvs0;
-		int32_t L_91 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_92 = V_2;
-		int32_t L_93 = ___0_i;
-		NullCheck(L_92);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_94 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_92)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_93)))->___vertex_BR);
-		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_95 = L_94->___uv;
-		NullCheck(L_90);
-		(L_90)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(3, L_91))), (Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3)L_95);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_96 = __this->___m_textInfo;
-		NullCheck(L_96);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_97 = L_96->___meshInfo;
-		int32_t L_98 = V_0;
-		NullCheck(L_97);
-		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_99 = ((L_97)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_98)))->___uvs2;
-		int32_t L_100 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_101 = V_2;
-		int32_t L_102 = ___0_i;
-		NullCheck(L_101);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_103 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_101)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_102)))->___vertex_BL);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_104 = L_103->___uv2;
-		NullCheck(L_99);
-		(L_99)->SetAt(static_cast<il2cpp_array_size_t>(L_100), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_104);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_105 = __this->___m_textInfo;
-		NullCheck(L_105);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_106 = L_105->___meshInfo;
-		int32_t L_107 = V_0;
-		NullCheck(L_106);
-		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_108 = ((L_106)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_107)))->___uvs2;
-		int32_t L_109 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_110 = V_2;
-		int32_t L_111 = ___0_i;
-		NullCheck(L_110);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_112 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_110)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_111)))->___vertex_TL);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_113 = L_112->___uv2;
-		NullCheck(L_108);
-		(L_108)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(1, L_109))), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_113);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_114 = __this->___m_textInfo;
-		NullCheck(L_114);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_115 = L_114->___meshInfo;
-		int32_t L_116 = V_0;
-		NullCheck(L_115);
-		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_117 = ((L_115)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_116)))->___uvs2;
-		int32_t L_118 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_119 = V_2;
-		int32_t L_120 = ___0_i;
-		NullCheck(L_119);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_121 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_119)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_120)))->___vertex_TR);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_122 = L_121->___uv2;
-		NullCheck(L_117);
-		(L_117)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(2, L_118))), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_122);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_123 = __this->___m_textInfo;
-		NullCheck(L_123);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_124 = L_123->___meshInfo;
-		int32_t L_125 = V_0;
-		NullCheck(L_124);
-		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_126 = ((L_124)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_125)))->___uvs2;
-		int32_t L_127 = V_1;
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_128 = V_2;
-		int32_t L_129 = ___0_i;
-		NullCheck(L_128);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_130 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_128)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_129)))->___vertex_BR);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_131 = L_130->___uv2;
-		NullCheck(L_126);
-		(L_126)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(3, L_127))), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_131);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_132 = __this->___m_textInfo;
-		NullCheck(L_132);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_133 = L_132->___meshInfo;
-		int32_t L_134 = V_0;
-		NullCheck(L_133);
-		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_135 = ((L_133)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_134)))->___colors32;
-		int32_t L_136 = V_1;
-		bool L_137 = __this->___m_ConvertToLinearSpace;
-		if (L_137)
-		{
-			G_B4_0 = L_136;
-			G_B4_1 = L_135;
+		(L_63)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(1, L_64))), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_66);
+		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_67 = V_3->___uvs2;
+		int32_t L_68 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_69 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TR);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_70 = L_69->___uv2;
+		NullCheck(L_67);
+		(L_67)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(2, L_68))), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_70);
+		Vector2U5BU5D_tFEBBC94BCC6C9C88277BA04047D2B3FDB6ED7FDA* L_71 = V_3->___uvs2;
+		int32_t L_72 = V_1;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_73 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BR);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_74 = L_73->___uv2;
+		NullCheck(L_71);
+		(L_71)->SetAt(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(3, L_72))), (Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7)L_74);
+		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_75 = V_3->___colors32;
+		int32_t L_76 = V_1;
+		bool L_77 = __this->___m_ConvertToLinearSpace;
+		if (L_77)
+		{
+			G_B4_0 = L_76;
+			G_B4_1 = L_75;
 			goto IL_02ec;
 		}
-		G_B3_0 = L_136;
-		G_B3_1 = L_135;
+		G_B3_0 = L_76;
+		G_B3_1 = L_75;
 	}
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_138 = V_2;
-		int32_t L_139 = ___0_i;
-		NullCheck(L_138);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_140 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_138)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_139)))->___vertex_BL);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_141 = L_140->___color;
-		G_B5_0 = L_141;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_78 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BL);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_79 = L_78->___color;
+		G_B5_0 = L_79;
 		G_B5_1 = G_B3_0;
 		G_B5_2 = G_B3_1;
 		goto IL_0302;
@@ -20021,14 +19996,11 @@ IL_0069:
 
 IL_02ec:
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_142 = V_2;
-		int32_t L_143 = ___0_i;
-		NullCheck(L_142);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_144 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_142)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_143)))->___vertex_BL);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_145 = L_144->___color;
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_146;
-		L_146 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_145, NULL);
-		G_B5_0 = L_146;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_80 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BL);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_81 = L_80->___color;
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_82;
+		L_82 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_81, NULL);
+		G_B5_0 = L_82;
 		G_B5_1 = G_B4_0;
 		G_B5_2 = G_B4_1;
 	}
@@ -20037,30 +20009,22 @@ IL_0302:
 	{
 		NullCheck(G_B5_2);
 		(G_B5_2)->SetAt(static_cast<il2cpp_array_size_t>(G_B5_1), (Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B)G_B5_0);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_147 = __this->___m_textInfo;
-		NullCheck(L_147);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_148 = L_147->___meshInfo;
-		int32_t L_149 = V_0;
-		NullCheck(L_148);
-		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_150 = ((L_148)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_149)))->___colors32;
-		int32_t L_151 = V_1;
-		bool L_152 = __this->___m_ConvertToLinearSpace;
-		if (L_152)
+		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_83 = V_3->___colors32;
+		int32_t L_84 = V_1;
+		bool L_85 = __this->___m_ConvertToLinearSpace;
+		if (L_85)
 		{
-			G_B7_0 = ((int32_t)il2cpp_codegen_add(1, L_151));
-			G_B7_1 = L_150;
+			G_B7_0 = ((int32_t)il2cpp_codegen_add(1, L_84));
+			G_B7_1 = L_83;
 			goto IL_033b;
 		}
-		G_B6_0 = ((int32_t)il2cpp_codegen_add(1, L_151));
-		G_B6_1 = L_150;
+		G_B6_0 = ((int32_t)il2cpp_codegen_add(1, L_84));
+		G_B6_1 = L_83;
 	}
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_153 = V_2;
-		int32_t L_154 = ___0_i;
-		NullCheck(L_153);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_155 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_153)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_154)))->___vertex_TL);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_156 = L_155->___color;
-		G_B8_0 = L_156;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_86 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TL);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_87 = L_86->___color;
+		G_B8_0 = L_87;
 		G_B8_1 = G_B6_0;
 		G_B8_2 = G_B6_1;
 		goto IL_0351;
@@ -20068,14 +20032,11 @@ IL_0302:
 
 IL_033b:
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_157 = V_2;
-		int32_t L_158 = ___0_i;
-		NullCheck(L_157);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_159 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_157)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_158)))->___vertex_TL);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_160 = L_159->___color;
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_161;
-		L_161 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_160, NULL);
-		G_B8_0 = L_161;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_88 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TL);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_89 = L_88->___color;
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_90;
+		L_90 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_89, NULL);
+		G_B8_0 = L_90;
 		G_B8_1 = G_B7_0;
 		G_B8_2 = G_B7_1;
 	}
@@ -20084,30 +20045,22 @@ IL_0351:
 	{
 		NullCheck(G_B8_2);
 		(G_B8_2)->SetAt(static_cast<il2cpp_array_size_t>(G_B8_1), (Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B)G_B8_0);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_162 = __this->___m_textInfo;
-		NullCheck(L_162);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_163 = L_162->___meshInfo;
-		int32_t L_164 = V_0;
-		NullCheck(L_163);
-		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_165 = ((L_163)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_164)))->___colors32;
-		int32_t L_166 = V_1;
-		bool L_167 = __this->___m_ConvertToLinearSpace;
-		if (L_167)
+		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_91 = V_3->___colors32;
+		int32_t L_92 = V_1;
+		bool L_93 = __this->___m_ConvertToLinearSpace;
+		if (L_93)
 		{
-			G_B10_0 = ((int32_t)il2cpp_codegen_add(2, L_166));
-			G_B10_1 = L_165;
+			G_B10_0 = ((int32_t)il2cpp_codegen_add(2, L_92));
+			G_B10_1 = L_91;
 			goto IL_038a;
 		}
-		G_B9_0 = ((int32_t)il2cpp_codegen_add(2, L_166));
-		G_B9_1 = L_165;
+		G_B9_0 = ((int32_t)il2cpp_codegen_add(2, L_92));
+		G_B9_1 = L_91;
 	}
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_168 = V_2;
-		int32_t L_169 = ___0_i;
-		NullCheck(L_168);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_170 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_168)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_169)))->___vertex_TR);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_171 = L_170->___color;
-		G_B11_0 = L_171;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_94 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TR);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_95 = L_94->___color;
+		G_B11_0 = L_95;
 		G_B11_1 = G_B9_0;
 		G_B11_2 = G_B9_1;
 		goto IL_03a0;
@@ -20115,14 +20068,11 @@ IL_0351:
 
 IL_038a:
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_172 = V_2;
-		int32_t L_173 = ___0_i;
-		NullCheck(L_172);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_174 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_172)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_173)))->___vertex_TR);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_175 = L_174->___color;
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_176;
-		L_176 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_175, NULL);
-		G_B11_0 = L_176;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_96 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_TR);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_97 = L_96->___color;
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_98;
+		L_98 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_97, NULL);
+		G_B11_0 = L_98;
 		G_B11_1 = G_B10_0;
 		G_B11_2 = G_B10_1;
 	}
@@ -20131,30 +20081,22 @@ IL_03a0:
 	{
 		NullCheck(G_B11_2);
 		(G_B11_2)->SetAt(static_cast<il2cpp_array_size_t>(G_B11_1), (Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B)G_B11_0);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_177 = __this->___m_textInfo;
-		NullCheck(L_177);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_178 = L_177->___meshInfo;
-		int32_t L_179 = V_0;
-		NullCheck(L_178);
-		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_180 = ((L_178)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_179)))->___colors32;
-		int32_t L_181 = V_1;
-		bool L_182 = __this->___m_ConvertToLinearSpace;
-		if (L_182)
+		Color32U5BU5D_t38116C3E91765C4C5726CE12C77FAD7F9F737259* L_99 = V_3->___colors32;
+		int32_t L_100 = V_1;
+		bool L_101 = __this->___m_ConvertToLinearSpace;
+		if (L_101)
 		{
-			G_B13_0 = ((int32_t)il2cpp_codegen_add(3, L_181));
-			G_B13_1 = L_180;
+			G_B13_0 = ((int32_t)il2cpp_codegen_add(3, L_100));
+			G_B13_1 = L_99;
 			goto IL_03d9;
 		}
-		G_B12_0 = ((int32_t)il2cpp_codegen_add(3, L_181));
-		G_B12_1 = L_180;
+		G_B12_0 = ((int32_t)il2cpp_codegen_add(3, L_100));
+		G_B12_1 = L_99;
 	}
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_183 = V_2;
-		int32_t L_184 = ___0_i;
-		NullCheck(L_183);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_185 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_183)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_184)))->___vertex_BR);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_186 = L_185->___color;
-		G_B14_0 = L_186;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_102 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BR);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_103 = L_102->___color;
+		G_B14_0 = L_103;
 		G_B14_1 = G_B12_0;
 		G_B14_2 = G_B12_1;
 		goto IL_03ef;
@@ -20162,14 +20104,11 @@ IL_03a0:
 
 IL_03d9:
 	{
-		TMP_CharacterInfoU5BU5D_t297D56FCF66DAA99D8FEA7C30F9F3926902C5B99* L_187 = V_2;
-		int32_t L_188 = ___0_i;
-		NullCheck(L_187);
-		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_189 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&((L_187)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_188)))->___vertex_BR);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_190 = L_189->___color;
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_191;
-		L_191 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_190, NULL);
-		G_B14_0 = L_191;
+		TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A* L_104 = (TMP_Vertex_t0FD80AE2515219689310A8F619A265667B530E1A*)(&V_4->___vertex_BR);
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_105 = L_104->___color;
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_106;
+		L_106 = TMPro_ExtensionMethods_GammaToLinear_mEDE3D5871121176AFBD644531D6E869AD28AE1AC(L_105, NULL);
+		G_B14_0 = L_106;
 		G_B14_1 = G_B13_0;
 		G_B14_2 = G_B13_1;
 	}
@@ -20178,13 +20117,9 @@ IL_03ef:
 	{
 		NullCheck(G_B14_2);
 		(G_B14_2)->SetAt(static_cast<il2cpp_array_size_t>(G_B14_1), (Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B)G_B14_0);
-		TMP_TextInfo_t09A8E906329422C3F0C059876801DD695B8D524D* L_192 = __this->___m_textInfo;
-		NullCheck(L_192);
-		TMP_MeshInfoU5BU5D_t3549EA3B9F542558E0DB1EDFAB98C612FE4231D7* L_193 = L_192->___meshInfo;
-		int32_t L_194 = V_0;
-		NullCheck(L_193);
-		int32_t L_195 = V_1;
-		((L_193)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_194)))->___vertexCount = ((int32_t)il2cpp_codegen_add(L_195, 4));
+		TMP_MeshInfo_t320C52212E9D672EBB5F5C18C3E0700AA33DD76B* L_107 = V_3;
+		int32_t L_108 = V_1;
+		L_107->___vertexCount = ((int32_t)il2cpp_codegen_add(L_108, 4));
 		return;
 	}
 }
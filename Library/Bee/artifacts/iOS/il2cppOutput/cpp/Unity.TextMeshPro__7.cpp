@@ -6615,126 +6615,113 @@ IL_0024:
 		NullCheck(L_6);
 		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_8;
 		L_8 = List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0(L_6, L_7, List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0_RuntimeMethod_var);
-		NullCheck(L_8);
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_9 = L_8->___baseMaterial;
+		V_2 = L_8;
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_9 = V_2;
 		NullCheck(L_9);
-		int32_t L_10;
-		L_10 = Object_GetInstanceID_m554FF4073C9465F3835574CC084E68AAEEC6CC6A(L_9, NULL);
-		int32_t L_11 = V_0;
+		int32_t L_10 = L_9->___stencilID;
+		int32_t L_11 = ___1_stencilID;
 		if ((!(((uint32_t)L_10) == ((uint32_t)L_11))))
 		{
 			goto IL_0078;
 		}
 	}
 	{
-		il2cpp_codegen_runtime_class_init_inline(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var);
-		List_1_t2D422802284C607CCDF0AEC2E66140D97474AB4F* L_12 = ((TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_StaticFields*)il2cpp_codegen_static_fields_for(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var))->___m_materialList;
-		int32_t L_13 = V_3;
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_12 = V_2;
 		NullCheck(L_12);
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_14;
-		L_14 = List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0(L_12, L_13, List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0_RuntimeMethod_var);
-		NullCheck(L_14);
-		int32_t L_15 = L_14->___stencilID;
-		int32_t L_16 = ___1_stencilID;
-		if ((!(((uint32_t)L_15) == ((uint32_t)L_16))))
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_13 = L_12->___baseMaterial;
+		NullCheck(L_13);
+		int32_t L_14;
+		L_14 = Object_GetInstanceID_m554FF4073C9465F3835574CC084E68AAEEC6CC6A(L_13, NULL);
+		int32_t L_15 = V_0;
+		if ((!(((uint32_t)L_14) == ((uint32_t)L_15))))
 		{
 			goto IL_0078;
 		}
 	}
 	{
-		il2cpp_codegen_runtime_class_init_inline(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var);
-		List_1_t2D422802284C607CCDF0AEC2E66140D97474AB4F* L_17 = ((TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_StaticFields*)il2cpp_codegen_static_fields_for(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var))->___m_materialList;
-		int32_t L_18 = V_3;
-		NullCheck(L_17);
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_19;
-		L_19 = List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0(L_17, L_18, List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0_RuntimeMethod_var);
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_20 = L_19;
-		NullCheck(L_20);
-		int32_t L_21 = L_20->___count;
-		NullCheck(L_20);
-		L_20->___count = ((int32_t)il2cpp_codegen_add(L_21, 1));
-		List_1_t2D422802284C607CCDF0AEC2E66140D97474AB4F* L_22 = ((TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_StaticFields*)il2cpp_codegen_static_fields_for(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var))->___m_materialList;
-		int32_t L_23 = V_3;
-		NullCheck(L_22);
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_24;
-		L_24 = List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0(L_22, L_23, List_1_get_Item_m99203461811024F3B79B29FB7CD6DE33ED07A4E0_RuntimeMethod_var);
-		NullCheck(L_24);
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_25 = L_24->___stencilMaterial;
-		return L_25;
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_16 = V_2;
+		NullCheck(L_16);
+		int32_t L_17 = L_16->___count;
+		NullCheck(L_16);
+		L_16->___count = ((int32_t)il2cpp_codegen_add(L_17, 1));
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_18 = V_2;
+		NullCheck(L_18);
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_19 = L_18->___stencilMaterial;
+		return L_19;
 	}
 
 IL_0078:
 	{
-		int32_t L_26 = V_3;
-		V_3 = ((int32_t)il2cpp_codegen_add(L_26, 1));
+		int32_t L_20 = V_3;
+		V_3 = ((int32_t)il2cpp_codegen_add(L_20, 1));
 	}
 
 IL_007c:
 	{
-		int32_t L_27 = V_3;
+		int32_t L_21 = V_3;
 		il2cpp_codegen_runtime_class_init_inline(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var);
-		List_1_t2D422802284C607CCDF0AEC2E66140D97474AB4F* L_28 = ((TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_StaticFields*)il2cpp_codegen_static_fields_for(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var))->___m_materialList;
-		NullCheck(L_28);
-		int32_t L_29;
-		L_29 = List_1_get_Count_m37F9E1909CE3099E1899AA19B91187E5270C6F1D_inline(L_28, List_1_get_Count_m37F9E1909CE3099E1899AA19B91187E5270C6F1D_RuntimeMethod_var);
-		if ((((int32_t)L_27) < ((int32_t)L_29)))
+		List_1_t2D422802284C607CCDF0AEC2E66140D97474AB4F* L_22 = ((TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_StaticFields*)il2cpp_codegen_static_fields_for(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var))->___m_materialList;
+		NullCheck(L_22);
+		int32_t L_23;
+		L_23 = List_1_get_Count_m37F9E1909CE3099E1899AA19B91187E5270C6F1D_inline(L_22, List_1_get_Count_m37F9E1909CE3099E1899AA19B91187E5270C6F1D_RuntimeMethod_var);
+		if ((((int32_t)L_21) < ((int32_t)L_23)))
 		{
 			goto IL_0024;
 		}
 	}
 	{
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_30 = ___0_baseMaterial;
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_31 = (Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3*)il2cpp_codegen_object_new(Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3_il2cpp_TypeInfo_var);
-		Material__ctor_mFCC42FB90257F1E8F7516A8640A79C465A39961C(L_31, L_30, NULL);
-		V_1 = L_31;
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_32 = V_1;
-		NullCheck(L_32);
-		Object_set_hideFlags_mACB8BFC903FB3B01BBD427753E791BF28B5E33D4(L_32, ((int32_t)61), NULL);
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_33 = V_1;
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_34 = ___0_baseMaterial;
-		NullCheck(L_34);
-		StringU5BU5D_t7674CD946EC0CE7B3AE0BE70E6EE85F2ECD9F248* L_35;
-		L_35 = Material_get_shaderKeywords_m11982F09EED6BB0A892342E1A72AEA470C44B105(L_34, NULL);
-		NullCheck(L_33);
-		Material_set_shaderKeywords_mD650CF82B2DBB75F001E373E2E1ACA30876F3AB8(L_33, L_35, NULL);
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_24 = ___0_baseMaterial;
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_25 = (Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3*)il2cpp_codegen_object_new(Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3_il2cpp_TypeInfo_var);
+		Material__ctor_mFCC42FB90257F1E8F7516A8640A79C465A39961C(L_25, L_24, NULL);
+		V_1 = L_25;
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_26 = V_1;
+		NullCheck(L_26);
+		Object_set_hideFlags_mACB8BFC903FB3B01BBD427753E791BF28B5E33D4(L_26, ((int32_t)61), NULL);
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_27 = V_1;
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_28 = ___0_baseMaterial;
+		NullCheck(L_28);
+		StringU5BU5D_t7674CD946EC0CE7B3AE0BE70E6EE85F2ECD9F248* L_29;
+		L_29 = Material_get_shaderKeywords_m11982F09EED6BB0A892342E1A72AEA470C44B105(L_28, NULL);
+		NullCheck(L_27);
+		Material_set_shaderKeywords_mD650CF82B2DBB75F001E373E2E1ACA30876F3AB8(L_27, L_29, NULL);
 		il2cpp_codegen_runtime_class_init_inline(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var);
 		ShaderUtilities_GetShaderPropertyIDs_m3EE2D3D2A31C57AE418FCC0782D0CC9D2FBD0A65(NULL);
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_36 = V_1;
-		int32_t L_37 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ID_StencilID;
-		int32_t L_38 = ___1_stencilID;
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_30 = V_1;
+		int32_t L_31 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ID_StencilID;
+		int32_t L_32 = ___1_stencilID;
+		NullCheck(L_30);
+		Material_SetFloat_m3ECFD92072347A8620254F014865984FA68211A8(L_30, L_31, ((float)L_32), NULL);
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_33 = V_1;
+		int32_t L_34 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ID_StencilComp;
+		NullCheck(L_33);
+		Material_SetFloat_m3ECFD92072347A8620254F014865984FA68211A8(L_33, L_34, (4.0f), NULL);
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_35 = (MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67*)il2cpp_codegen_object_new(MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67_il2cpp_TypeInfo_var);
+		MaskingMaterial__ctor_mA1BA8800085879CFA3DE2A0DED61A4AA92C62B2C(L_35, NULL);
+		V_2 = L_35;
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_36 = V_2;
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_37 = ___0_baseMaterial;
 		NullCheck(L_36);
-		Material_SetFloat_m3ECFD92072347A8620254F014865984FA68211A8(L_36, L_37, ((float)L_38), NULL);
+		L_36->___baseMaterial = L_37;
+		Il2CppCodeGenWriteBarrier((void**)(&L_36->___baseMaterial), (void*)L_37);
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_38 = V_2;
 		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_39 = V_1;
-		int32_t L_40 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ID_StencilComp;
-		NullCheck(L_39);
-		Material_SetFloat_m3ECFD92072347A8620254F014865984FA68211A8(L_39, L_40, (4.0f), NULL);
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_41 = (MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67*)il2cpp_codegen_object_new(MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67_il2cpp_TypeInfo_var);
-		MaskingMaterial__ctor_mA1BA8800085879CFA3DE2A0DED61A4AA92C62B2C(L_41, NULL);
-		V_2 = L_41;
+		NullCheck(L_38);
+		L_38->___stencilMaterial = L_39;
+		Il2CppCodeGenWriteBarrier((void**)(&L_38->___stencilMaterial), (void*)L_39);
+		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_40 = V_2;
+		int32_t L_41 = ___1_stencilID;
+		NullCheck(L_40);
+		L_40->___stencilID = L_41;
 		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_42 = V_2;
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_43 = ___0_baseMaterial;
 		NullCheck(L_42);
-		L_42->___baseMaterial = L_43;
-		Il2CppCodeGenWriteBarrier((void**)(&L_42->___baseMaterial), (void*)L_43);
+		L_42->___count = 1;
+		il2cpp_codegen_runtime_class_init_inline(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var);
+		List_1_t2D422802284C607CCDF0AEC2E66140D97474AB4F* L_43 = ((TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_StaticFields*)il2cpp_codegen_static_fields_for(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var))->___m_materialList;
 		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_44 = V_2;
+		NullCheck(L_43);
+		List_1_Add_m42CC9A7A980D6480951694926AB601618ED04838_inline(L_43, L_44, List_1_Add_m42CC9A7A980D6480951694926AB601618ED04838_RuntimeMethod_var);
 		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_45 = V_1;
-		NullCheck(L_44);
-		L_44->___stencilMaterial = L_45;
-		Il2CppCodeGenWriteBarrier((void**)(&L_44->___stencilMaterial), (void*)L_45);
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_46 = V_2;
-		int32_t L_47 = ___1_stencilID;
-		NullCheck(L_46);
-		L_46->___stencilID = L_47;
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_48 = V_2;
-		NullCheck(L_48);
-		L_48->___count = 1;
-		il2cpp_codegen_runtime_class_init_inline(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var);
-		List_1_t2D422802284C607CCDF0AEC2E66140D97474AB4F* L_49 = ((TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_StaticFields*)il2cpp_codegen_static_fields_for(TMP_MaterialManager_t67E8437E12407A99A3E58F6033B8D3749A321A96_il2cpp_TypeInfo_var))->___m_materialList;
-		MaskingMaterial_t8FEFB73A16A318BC617A015E4E56C2749829EF67* L_50 = V_2;
-		NullCheck(L_49);
-		List_1_Add_m42CC9A7A980D6480951694926AB601618ED04838_inline(L_49, L_50, List_1_Add_m42CC9A7A980D6480951694926AB601618ED04838_RuntimeMethod_var);
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_51 = V_1;
-		return L_51;
+		return L_45;
 	}
 }
 IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void TMP_MaterialManager_ReleaseStencilMaterial_mECF794E6299D84E46FBC0BC6F23155A8751FCD41 (Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* ___0_stencilMaterial, const RuntimeMethod* method) 
@@ -21407,6 +21394,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void TMP_SubMeshUI_UpdateMaterial_m4147C455FD
 		s_Il2CppMethodInitialized = true;
 	}
 	float V_0 = 0.0f;
+	Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* V_1 = NULL;
+	CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* V_2 = NULL;
 	{
 		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_0 = __this->___m_sharedMaterial;
 		il2cpp_codegen_runtime_class_init_inline(Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C_il2cpp_TypeInfo_var);
@@ -21440,6 +21429,7 @@ IL_000f:
 		NullCheck(L_5);
 		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_6;
 		L_6 = VirtualFuncInvoker0< Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* >::Invoke(67, L_5);
+		V_1 = L_6;
 		il2cpp_codegen_runtime_class_init_inline(Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C_il2cpp_TypeInfo_var);
 		bool L_7;
 		L_7 = Object_op_Inequality_mD0BE578448EAA61948F25C32F8DD55AB1F778602(L_6, (Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C*)NULL, NULL);
@@ -21449,36 +21439,32 @@ IL_000f:
 		}
 	}
 	{
-		TMP_Text_tE8D677872D43AD4B2AAF0D6101692A17D0B251A9* L_8;
-		L_8 = TMP_SubMeshUI_get_textComponent_m899050C714DCF7C38409E40ACED46128426E5981(__this, NULL);
-		NullCheck(L_8);
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_9;
-		L_9 = VirtualFuncInvoker0< Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* >::Invoke(67, L_8);
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_8 = V_1;
 		il2cpp_codegen_runtime_class_init_inline(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var);
-		String_t* L_10 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ShaderTag_CullMode;
-		NullCheck(L_9);
-		float L_11;
-		L_11 = Material_GetFloat_m2A77F10E6AA13EA3FA56166EFEA897115A14FA5A(L_9, L_10, NULL);
-		V_0 = L_11;
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_12 = __this->___m_sharedMaterial;
-		String_t* L_13 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ShaderTag_CullMode;
-		float L_14 = V_0;
-		NullCheck(L_12);
-		Material_SetFloat_m879CF81D740BAE6F23C9822400679F4D16365836(L_12, L_13, L_14, NULL);
+		String_t* L_9 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ShaderTag_CullMode;
+		NullCheck(L_8);
+		float L_10;
+		L_10 = Material_GetFloat_m2A77F10E6AA13EA3FA56166EFEA897115A14FA5A(L_8, L_9, NULL);
+		V_0 = L_10;
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_11 = __this->___m_sharedMaterial;
+		String_t* L_12 = ((ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_StaticFields*)il2cpp_codegen_static_fields_for(ShaderUtilities_t9BE0345DF949745FC0EB9A1119E204F2F129298F_il2cpp_TypeInfo_var))->___ShaderTag_CullMode;
+		float L_13 = V_0;
+		NullCheck(L_11);
+		Material_SetFloat_m879CF81D740BAE6F23C9822400679F4D16365836(L_11, L_12, L_13, NULL);
 	}
 
 IL_005b:
 	{
-		CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* L_15;
-		L_15 = Graphic_get_canvasRenderer_m62AB727277A28728264860232642DA6EC20DEAB1(__this, NULL);
+		CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* L_14;
+		L_14 = Graphic_get_canvasRenderer_m62AB727277A28728264860232642DA6EC20DEAB1(__this, NULL);
+		V_2 = L_14;
+		NullCheck(L_14);
+		CanvasRenderer_set_materialCount_m333926C78CD98557B86A8EAC66F47BD4DD4554C3(L_14, 1, NULL);
+		CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* L_15 = V_2;
+		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_16;
+		L_16 = VirtualFuncInvoker0< Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* >::Invoke(34, __this);
 		NullCheck(L_15);
-		CanvasRenderer_set_materialCount_m333926C78CD98557B86A8EAC66F47BD4DD4554C3(L_15, 1, NULL);
-		CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* L_16;
-		L_16 = Graphic_get_canvasRenderer_m62AB727277A28728264860232642DA6EC20DEAB1(__this, NULL);
-		Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* L_17;
-		L_17 = VirtualFuncInvoker0< Material_t18053F08F347D0DCA5E1140EC7EC4533DD8A14E3* >::Invoke(34, __this);
-		NullCheck(L_16);
-		CanvasRenderer_SetMaterial_mBB733E272FB6A5B30C3B24F557AF5ED9EAC5DBD7(L_16, L_17, 0, NULL);
+		CanvasRenderer_SetMaterial_mBB733E272FB6A5B30C3B24F557AF5ED9EAC5DBD7(L_15, L_16, 0, NULL);
 		return;
 	}
 }
@@ -23415,86 +23401,98 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool TMP_TextParsingUtilities_IsDiacriticalMa
 {
 	{
 		uint32_t L_0 = ___0_c;
-		if ((!(((uint32_t)L_0) >= ((uint32_t)((int32_t)768)))))
+		if ((((uint32_t)L_0) >= ((uint32_t)((int32_t)768))))
 		{
-			goto IL_0010;
+			goto IL_000a;
 		}
 	}
+	{
+		return (bool)0;
+	}
+
+IL_000a:
 	{
 		uint32_t L_1 = ___0_c;
-		if ((!(((uint32_t)L_1) > ((uint32_t)((int32_t)879)))))
+		if ((!(((uint32_t)L_1) >= ((uint32_t)((int32_t)768)))))
 		{
-			goto IL_0056;
+			goto IL_001a;
 		}
 	}
-
-IL_0010:
 	{
 		uint32_t L_2 = ___0_c;
-		if ((!(((uint32_t)L_2) >= ((uint32_t)((int32_t)6832)))))
+		if ((!(((uint32_t)L_2) > ((uint32_t)((int32_t)879)))))
 		{
-			goto IL_0020;
+			goto IL_0060;
 		}
 	}
+
+IL_001a:
 	{
 		uint32_t L_3 = ___0_c;
-		if ((!(((uint32_t)L_3) > ((uint32_t)((int32_t)6911)))))
+		if ((!(((uint32_t)L_3) >= ((uint32_t)((int32_t)6832)))))
 		{
-			goto IL_0056;
+			goto IL_002a;
 		}
 	}
-
-IL_0020:
 	{
 		uint32_t L_4 = ___0_c;
-		if ((!(((uint32_t)L_4) >= ((uint32_t)((int32_t)7616)))))
+		if ((!(((uint32_t)L_4) > ((uint32_t)((int32_t)6911)))))
 		{
-			goto IL_0030;
+			goto IL_0060;
 		}
 	}
+
+IL_002a:
 	{
 		uint32_t L_5 = ___0_c;
-		if ((!(((uint32_t)L_5) > ((uint32_t)((int32_t)7679)))))
+		if ((!(((uint32_t)L_5) >= ((uint32_t)((int32_t)7616)))))
 		{
-			goto IL_0056;
+			goto IL_003a;
 		}
 	}
-
-IL_0030:
 	{
 		uint32_t L_6 = ___0_c;
-		if ((!(((uint32_t)L_6) >= ((uint32_t)((int32_t)8400)))))
+		if ((!(((uint32_t)L_6) > ((uint32_t)((int32_t)7679)))))
 		{
-			goto IL_0040;
+			goto IL_0060;
 		}
 	}
+
+IL_003a:
 	{
 		uint32_t L_7 = ___0_c;
-		if ((!(((uint32_t)L_7) > ((uint32_t)((int32_t)8447)))))
+		if ((!(((uint32_t)L_7) >= ((uint32_t)((int32_t)8400)))))
 		{
-			goto IL_0056;
+			goto IL_004a;
 		}
 	}
-
-IL_0040:
 	{
 		uint32_t L_8 = ___0_c;
-		if ((!(((uint32_t)L_8) >= ((uint32_t)((int32_t)65056)))))
+		if ((!(((uint32_t)L_8) > ((uint32_t)((int32_t)8447)))))
 		{
-			goto IL_0054;
+			goto IL_0060;
 		}
 	}
+
+IL_004a:
 	{
 		uint32_t L_9 = ___0_c;
-		return (bool)((((int32_t)((!(((uint32_t)L_9) <= ((uint32_t)((int32_t)65071))))? 1 : 0)) == ((int32_t)0))? 1 : 0);
+		if ((!(((uint32_t)L_9) >= ((uint32_t)((int32_t)65056)))))
+		{
+			goto IL_005e;
+		}
+	}
+	{
+		uint32_t L_10 = ___0_c;
+		return (bool)((((int32_t)((!(((uint32_t)L_10) <= ((uint32_t)((int32_t)65071))))? 1 : 0)) == ((int32_t)0))? 1 : 0);
 	}
 
-IL_0054:
+IL_005e:
 	{
 		return (bool)0;
 	}
 
-IL_0056:
+IL_0060:
 	{
 		return (bool)1;
 	}
@@ -23503,338 +23501,350 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool TMP_TextParsingUtilities_IsBaseGlyph_mB8
 {
 	{
 		uint32_t L_0 = ___0_c;
-		if ((!(((uint32_t)L_0) >= ((uint32_t)((int32_t)768)))))
+		if ((((uint32_t)L_0) >= ((uint32_t)((int32_t)768))))
 		{
-			goto IL_0013;
+			goto IL_000a;
 		}
 	}
+	{
+		return (bool)1;
+	}
+
+IL_000a:
 	{
 		uint32_t L_1 = ___0_c;
-		if ((!(((uint32_t)L_1) > ((uint32_t)((int32_t)879)))))
+		if ((!(((uint32_t)L_1) >= ((uint32_t)((int32_t)768)))))
 		{
-			goto IL_017d;
+			goto IL_001d;
 		}
 	}
-
-IL_0013:
 	{
 		uint32_t L_2 = ___0_c;
-		if ((!(((uint32_t)L_2) >= ((uint32_t)((int32_t)6832)))))
+		if ((!(((uint32_t)L_2) > ((uint32_t)((int32_t)879)))))
 		{
-			goto IL_0026;
+			goto IL_0187;
 		}
 	}
+
+IL_001d:
 	{
 		uint32_t L_3 = ___0_c;
-		if ((!(((uint32_t)L_3) > ((uint32_t)((int32_t)6911)))))
+		if ((!(((uint32_t)L_3) >= ((uint32_t)((int32_t)6832)))))
 		{
-			goto IL_017d;
+			goto IL_0030;
 		}
 	}
-
-IL_0026:
 	{
 		uint32_t L_4 = ___0_c;
-		if ((!(((uint32_t)L_4) >= ((uint32_t)((int32_t)7616)))))
+		if ((!(((uint32_t)L_4) > ((uint32_t)((int32_t)6911)))))
 		{
-			goto IL_0039;
+			goto IL_0187;
 		}
 	}
+
+IL_0030:
 	{
 		uint32_t L_5 = ___0_c;
-		if ((!(((uint32_t)L_5) > ((uint32_t)((int32_t)7679)))))
+		if ((!(((uint32_t)L_5) >= ((uint32_t)((int32_t)7616)))))
 		{
-			goto IL_017d;
+			goto IL_0043;
 		}
 	}
-
-IL_0039:
 	{
 		uint32_t L_6 = ___0_c;
-		if ((!(((uint32_t)L_6) >= ((uint32_t)((int32_t)8400)))))
+		if ((!(((uint32_t)L_6) > ((uint32_t)((int32_t)7679)))))
 		{
-			goto IL_004c;
+			goto IL_0187;
 		}
 	}
+
+IL_0043:
 	{
 		uint32_t L_7 = ___0_c;
-		if ((!(((uint32_t)L_7) > ((uint32_t)((int32_t)8447)))))
+		if ((!(((uint32_t)L_7) >= ((uint32_t)((int32_t)8400)))))
 		{
-			goto IL_017d;
+			goto IL_0056;
 		}
 	}
-
-IL_004c:
 	{
 		uint32_t L_8 = ___0_c;
-		if ((!(((uint32_t)L_8) >= ((uint32_t)((int32_t)65056)))))
+		if ((!(((uint32_t)L_8) > ((uint32_t)((int32_t)8447)))))
 		{
-			goto IL_005f;
+			goto IL_0187;
 		}
 	}
+
+IL_0056:
 	{
 		uint32_t L_9 = ___0_c;
-		if ((!(((uint32_t)L_9) > ((uint32_t)((int32_t)65071)))))
+		if ((!(((uint32_t)L_9) >= ((uint32_t)((int32_t)65056)))))
 		{
-			goto IL_017d;
+			goto IL_0069;
 		}
 	}
-
-IL_005f:
 	{
 		uint32_t L_10 = ___0_c;
-		if ((((int32_t)L_10) == ((int32_t)((int32_t)3633))))
+		if ((!(((uint32_t)L_10) > ((uint32_t)((int32_t)65071)))))
 		{
-			goto IL_017d;
+			goto IL_0187;
 		}
 	}
+
+IL_0069:
 	{
 		uint32_t L_11 = ___0_c;
-		if ((!(((uint32_t)L_11) >= ((uint32_t)((int32_t)3636)))))
+		if ((((int32_t)L_11) == ((int32_t)((int32_t)3633))))
 		{
-			goto IL_007d;
+			goto IL_0187;
 		}
 	}
 	{
 		uint32_t L_12 = ___0_c;
-		if ((!(((uint32_t)L_12) > ((uint32_t)((int32_t)3642)))))
+		if ((!(((uint32_t)L_12) >= ((uint32_t)((int32_t)3636)))))
 		{
-			goto IL_017d;
+			goto IL_0087;
 		}
 	}
-
-IL_007d:
 	{
 		uint32_t L_13 = ___0_c;
-		if ((!(((uint32_t)L_13) >= ((uint32_t)((int32_t)3655)))))
+		if ((!(((uint32_t)L_13) > ((uint32_t)((int32_t)3642)))))
 		{
-			goto IL_0090;
+			goto IL_0187;
 		}
 	}
+
+IL_0087:
 	{
 		uint32_t L_14 = ___0_c;
-		if ((!(((uint32_t)L_14) > ((uint32_t)((int32_t)3662)))))
+		if ((!(((uint32_t)L_14) >= ((uint32_t)((int32_t)3655)))))
 		{
-			goto IL_017d;
+			goto IL_009a;
 		}
 	}
-
-IL_0090:
 	{
 		uint32_t L_15 = ___0_c;
-		if ((!(((uint32_t)L_15) >= ((uint32_t)((int32_t)1425)))))
+		if ((!(((uint32_t)L_15) > ((uint32_t)((int32_t)3662)))))
 		{
-			goto IL_00a3;
+			goto IL_0187;
 		}
 	}
+
+IL_009a:
 	{
 		uint32_t L_16 = ___0_c;
-		if ((!(((uint32_t)L_16) > ((uint32_t)((int32_t)1469)))))
+		if ((!(((uint32_t)L_16) >= ((uint32_t)((int32_t)1425)))))
 		{
-			goto IL_017d;
+			goto IL_00ad;
 		}
 	}
-
-IL_00a3:
 	{
 		uint32_t L_17 = ___0_c;
-		if ((((int32_t)L_17) == ((int32_t)((int32_t)1471))))
+		if ((!(((uint32_t)L_17) > ((uint32_t)((int32_t)1469)))))
 		{
-			goto IL_017d;
+			goto IL_0187;
 		}
 	}
+
+IL_00ad:
 	{
 		uint32_t L_18 = ___0_c;
-		if ((!(((uint32_t)L_18) >= ((uint32_t)((int32_t)1473)))))
+		if ((((int32_t)L_18) == ((int32_t)((int32_t)1471))))
 		{
-			goto IL_00c1;
+			goto IL_0187;
 		}
 	}
 	{
 		uint32_t L_19 = ___0_c;
-		if ((!(((uint32_t)L_19) > ((uint32_t)((int32_t)1474)))))
+		if ((!(((uint32_t)L_19) >= ((uint32_t)((int32_t)1473)))))
 		{
-			goto IL_017d;
+			goto IL_00cb;
 		}
 	}
-
-IL_00c1:
 	{
 		uint32_t L_20 = ___0_c;
-		if ((!(((uint32_t)L_20) >= ((uint32_t)((int32_t)1476)))))
+		if ((!(((uint32_t)L_20) > ((uint32_t)((int32_t)1474)))))
 		{
-			goto IL_00d4;
+			goto IL_0187;
 		}
 	}
+
+IL_00cb:
 	{
 		uint32_t L_21 = ___0_c;
-		if ((!(((uint32_t)L_21) > ((uint32_t)((int32_t)1477)))))
+		if ((!(((uint32_t)L_21) >= ((uint32_t)((int32_t)1476)))))
 		{
-			goto IL_017d;
+			goto IL_00de;
 		}
 	}
-
-IL_00d4:
 	{
 		uint32_t L_22 = ___0_c;
-		if ((((int32_t)L_22) == ((int32_t)((int32_t)1479))))
+		if ((!(((uint32_t)L_22) > ((uint32_t)((int32_t)1477)))))
 		{
-			goto IL_017d;
+			goto IL_0187;
 		}
 	}
+
+IL_00de:
 	{
 		uint32_t L_23 = ___0_c;
-		if ((!(((uint32_t)L_23) >= ((uint32_t)((int32_t)1552)))))
+		if ((((int32_t)L_23) == ((int32_t)((int32_t)1479))))
 		{
-			goto IL_00f2;
+			goto IL_0187;
 		}
 	}
 	{
 		uint32_t L_24 = ___0_c;
-		if ((!(((uint32_t)L_24) > ((uint32_t)((int32_t)1562)))))
+		if ((!(((uint32_t)L_24) >= ((uint32_t)((int32_t)1552)))))
 		{
-			goto IL_017d;
+			goto IL_00fc;
 		}
 	}
-
-IL_00f2:
 	{
 		uint32_t L_25 = ___0_c;
-		if ((!(((uint32_t)L_25) >= ((uint32_t)((int32_t)1611)))))
+		if ((!(((uint32_t)L_25) > ((uint32_t)((int32_t)1562)))))
 		{
-			goto IL_0102;
+			goto IL_0187;
 		}
 	}
+
+IL_00fc:
 	{
 		uint32_t L_26 = ___0_c;
-		if ((!(((uint32_t)L_26) > ((uint32_t)((int32_t)1631)))))
+		if ((!(((uint32_t)L_26) >= ((uint32_t)((int32_t)1611)))))
 		{
-			goto IL_017d;
+			goto IL_010c;
 		}
 	}
-
-IL_0102:
 	{
 		uint32_t L_27 = ___0_c;
-		if ((((int32_t)L_27) == ((int32_t)((int32_t)1648))))
+		if ((!(((uint32_t)L_27) > ((uint32_t)((int32_t)1631)))))
 		{
-			goto IL_017d;
+			goto IL_0187;
 		}
 	}
+
+IL_010c:
 	{
 		uint32_t L_28 = ___0_c;
-		if ((!(((uint32_t)L_28) >= ((uint32_t)((int32_t)1750)))))
+		if ((((int32_t)L_28) == ((int32_t)((int32_t)1648))))
 		{
-			goto IL_011a;
+			goto IL_0187;
 		}
 	}
 	{
 		uint32_t L_29 = ___0_c;
-		if ((!(((uint32_t)L_29) > ((uint32_t)((int32_t)1756)))))
+		if ((!(((uint32_t)L_29) >= ((uint32_t)((int32_t)1750)))))
 		{
-			goto IL_017d;
+			goto IL_0124;
 		}
 	}
-
-IL_011a:
 	{
 		uint32_t L_30 = ___0_c;
-		if ((!(((uint32_t)L_30) >= ((uint32_t)((int32_t)1759)))))
+		if ((!(((uint32_t)L_30) > ((uint32_t)((int32_t)1756)))))
 		{
-			goto IL_012a;
+			goto IL_0187;
 		}
 	}
+
+IL_0124:
 	{
 		uint32_t L_31 = ___0_c;
-		if ((!(((uint32_t)L_31) > ((uint32_t)((int32_t)1764)))))
+		if ((!(((uint32_t)L_31) >= ((uint32_t)((int32_t)1759)))))
 		{
-			goto IL_017d;
+			goto IL_0134;
 		}
 	}
-
-IL_012a:
 	{
 		uint32_t L_32 = ___0_c;
-		if ((!(((uint32_t)L_32) >= ((uint32_t)((int32_t)1767)))))
+		if ((!(((uint32_t)L_32) > ((uint32_t)((int32_t)1764)))))
 		{
-			goto IL_013a;
+			goto IL_0187;
 		}
 	}
+
+IL_0134:
 	{
 		uint32_t L_33 = ___0_c;
-		if ((!(((uint32_t)L_33) > ((uint32_t)((int32_t)1768)))))
+		if ((!(((uint32_t)L_33) >= ((uint32_t)((int32_t)1767)))))
 		{
-			goto IL_017d;
+			goto IL_0144;
 		}
 	}
-
-IL_013a:
 	{
 		uint32_t L_34 = ___0_c;
-		if ((!(((uint32_t)L_34) >= ((uint32_t)((int32_t)1770)))))
+		if ((!(((uint32_t)L_34) > ((uint32_t)((int32_t)1768)))))
 		{
-			goto IL_014a;
+			goto IL_0187;
 		}
 	}
+
+IL_0144:
 	{
 		uint32_t L_35 = ___0_c;
-		if ((!(((uint32_t)L_35) > ((uint32_t)((int32_t)1773)))))
+		if ((!(((uint32_t)L_35) >= ((uint32_t)((int32_t)1770)))))
 		{
-			goto IL_017d;
+			goto IL_0154;
 		}
 	}
-
-IL_014a:
 	{
 		uint32_t L_36 = ___0_c;
-		if ((!(((uint32_t)L_36) >= ((uint32_t)((int32_t)2259)))))
+		if ((!(((uint32_t)L_36) > ((uint32_t)((int32_t)1773)))))
 		{
-			goto IL_015a;
+			goto IL_0187;
 		}
 	}
+
+IL_0154:
 	{
 		uint32_t L_37 = ___0_c;
-		if ((!(((uint32_t)L_37) > ((uint32_t)((int32_t)2273)))))
+		if ((!(((uint32_t)L_37) >= ((uint32_t)((int32_t)2259)))))
 		{
-			goto IL_017d;
+			goto IL_0164;
 		}
 	}
-
-IL_015a:
 	{
 		uint32_t L_38 = ___0_c;
-		if ((!(((uint32_t)L_38) >= ((uint32_t)((int32_t)2275)))))
+		if ((!(((uint32_t)L_38) > ((uint32_t)((int32_t)2273)))))
 		{
-			goto IL_016a;
+			goto IL_0187;
 		}
 	}
+
+IL_0164:
 	{
 		uint32_t L_39 = ___0_c;
-		if ((!(((uint32_t)L_39) > ((uint32_t)((int32_t)2303)))))
+		if ((!(((uint32_t)L_39) >= ((uint32_t)((int32_t)2275)))))
 		{
-			goto IL_017d;
+			goto IL_0174;
 		}
 	}
-
-IL_016a:
 	{
 		uint32_t L_40 = ___0_c;
-		if ((!(((uint32_t)L_40) >= ((uint32_t)((int32_t)64434)))))
+		if ((!(((uint32_t)L_40) > ((uint32_t)((int32_t)2303)))))
 		{
-			goto IL_017b;
+			goto IL_0187;
 		}
 	}
+
+IL_0174:
 	{
 		uint32_t L_41 = ___0_c;
-		return (bool)((!(((uint32_t)L_41) <= ((uint32_t)((int32_t)64449))))? 1 : 0);
+		if ((!(((uint32_t)L_41) >= ((uint32_t)((int32_t)64434)))))
+		{
+			goto IL_0185;
+		}
+	}
+	{
+		uint32_t L_42 = ___0_c;
+		return (bool)((!(((uint32_t)L_42) <= ((uint32_t)((int32_t)64449))))? 1 : 0);
 	}
 
-IL_017b:
+IL_0185:
 	{
 		return (bool)1;
 	}
 
-IL_017d:
+IL_0187:
 	{
 		return (bool)0;
 	}
@@ -23881,102 +23891,114 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool TMP_TextParsingUtilities_IsHangul_mD91D4
 {
 	{
 		uint32_t L_0 = ___0_c;
-		if ((!(((uint32_t)L_0) >= ((uint32_t)((int32_t)4352)))))
+		if ((((uint32_t)L_0) >= ((uint32_t)((int32_t)4352))))
 		{
-			goto IL_0010;
+			goto IL_000a;
 		}
 	}
+	{
+		return (bool)0;
+	}
+
+IL_000a:
 	{
 		uint32_t L_1 = ___0_c;
-		if ((!(((uint32_t)L_1) > ((uint32_t)((int32_t)4607)))))
+		if ((!(((uint32_t)L_1) >= ((uint32_t)((int32_t)4352)))))
 		{
-			goto IL_0066;
+			goto IL_001a;
 		}
 	}
-
-IL_0010:
 	{
 		uint32_t L_2 = ___0_c;
-		if ((!(((uint32_t)L_2) >= ((uint32_t)((int32_t)43360)))))
+		if ((!(((uint32_t)L_2) > ((uint32_t)((int32_t)4607)))))
 		{
-			goto IL_0020;
+			goto IL_0070;
 		}
 	}
+
+IL_001a:
 	{
 		uint32_t L_3 = ___0_c;
-		if ((!(((uint32_t)L_3) > ((uint32_t)((int32_t)43391)))))
+		if ((!(((uint32_t)L_3) >= ((uint32_t)((int32_t)43360)))))
 		{
-			goto IL_0066;
+			goto IL_002a;
 		}
 	}
-
-IL_0020:
 	{
 		uint32_t L_4 = ___0_c;
-		if ((!(((uint32_t)L_4) >= ((uint32_t)((int32_t)55216)))))
+		if ((!(((uint32_t)L_4) > ((uint32_t)((int32_t)43391)))))
 		{
-			goto IL_0030;
+			goto IL_0070;
 		}
 	}
+
+IL_002a:
 	{
 		uint32_t L_5 = ___0_c;
-		if ((!(((uint32_t)L_5) > ((uint32_t)((int32_t)55295)))))
+		if ((!(((uint32_t)L_5) >= ((uint32_t)((int32_t)55216)))))
 		{
-			goto IL_0066;
+			goto IL_003a;
 		}
 	}
-
-IL_0030:
 	{
 		uint32_t L_6 = ___0_c;
-		if ((!(((uint32_t)L_6) >= ((uint32_t)((int32_t)12592)))))
+		if ((!(((uint32_t)L_6) > ((uint32_t)((int32_t)55295)))))
 		{
-			goto IL_0040;
+			goto IL_0070;
 		}
 	}
+
+IL_003a:
 	{
 		uint32_t L_7 = ___0_c;
-		if ((!(((uint32_t)L_7) > ((uint32_t)((int32_t)12687)))))
+		if ((!(((uint32_t)L_7) >= ((uint32_t)((int32_t)12592)))))
 		{
-			goto IL_0066;
+			goto IL_004a;
 		}
 	}
-
-IL_0040:
 	{
 		uint32_t L_8 = ___0_c;
-		if ((!(((uint32_t)L_8) >= ((uint32_t)((int32_t)65440)))))
+		if ((!(((uint32_t)L_8) > ((uint32_t)((int32_t)12687)))))
 		{
-			goto IL_0050;
+			goto IL_0070;
 		}
 	}
+
+IL_004a:
 	{
 		uint32_t L_9 = ___0_c;
-		if ((!(((uint32_t)L_9) > ((uint32_t)((int32_t)65500)))))
+		if ((!(((uint32_t)L_9) >= ((uint32_t)((int32_t)65440)))))
 		{
-			goto IL_0066;
+			goto IL_005a;
 		}
 	}
-
-IL_0050:
 	{
 		uint32_t L_10 = ___0_c;
-		if ((!(((uint32_t)L_10) >= ((uint32_t)((int32_t)44032)))))
+		if ((!(((uint32_t)L_10) > ((uint32_t)((int32_t)65500)))))
 		{
-			goto IL_0064;
+			goto IL_0070;
 		}
 	}
+
+IL_005a:
 	{
 		uint32_t L_11 = ___0_c;
-		return (bool)((((int32_t)((!(((uint32_t)L_11) <= ((uint32_t)((int32_t)55215))))? 1 : 0)) == ((int32_t)0))? 1 : 0);
+		if ((!(((uint32_t)L_11) >= ((uint32_t)((int32_t)44032)))))
+		{
+			goto IL_006e;
+		}
+	}
+	{
+		uint32_t L_12 = ___0_c;
+		return (bool)((((int32_t)((!(((uint32_t)L_12) <= ((uint32_t)((int32_t)55215))))? 1 : 0)) == ((int32_t)0))? 1 : 0);
 	}
 
-IL_0064:
+IL_006e:
 	{
 		return (bool)0;
 	}
 
-IL_0066:
+IL_0070:
 	{
 		return (bool)1;
 	}
@@ -23985,406 +24007,418 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool TMP_TextParsingUtilities_IsCJK_m5FDC8838
 {
 	{
 		uint32_t L_0 = ___0_c;
-		if ((!(((uint32_t)L_0) >= ((uint32_t)((int32_t)12544)))))
+		if ((((uint32_t)L_0) >= ((uint32_t)((int32_t)11904))))
 		{
-			goto IL_0013;
+			goto IL_000a;
 		}
 	}
+	{
+		return (bool)0;
+	}
+
+IL_000a:
 	{
 		uint32_t L_1 = ___0_c;
-		if ((!(((uint32_t)L_1) > ((uint32_t)((int32_t)12591)))))
+		if ((!(((uint32_t)L_1) >= ((uint32_t)((int32_t)12544)))))
 		{
-			goto IL_01c9;
+			goto IL_001d;
 		}
 	}
-
-IL_0013:
 	{
 		uint32_t L_2 = ___0_c;
-		if ((!(((uint32_t)L_2) >= ((uint32_t)((int32_t)12704)))))
+		if ((!(((uint32_t)L_2) > ((uint32_t)((int32_t)12591)))))
 		{
-			goto IL_0026;
+			goto IL_01d3;
 		}
 	}
+
+IL_001d:
 	{
 		uint32_t L_3 = ___0_c;
-		if ((!(((uint32_t)L_3) > ((uint32_t)((int32_t)12735)))))
+		if ((!(((uint32_t)L_3) >= ((uint32_t)((int32_t)12704)))))
 		{
-			goto IL_01c9;
+			goto IL_0030;
 		}
 	}
-
-IL_0026:
 	{
 		uint32_t L_4 = ___0_c;
-		if ((!(((uint32_t)L_4) >= ((uint32_t)((int32_t)19968)))))
+		if ((!(((uint32_t)L_4) > ((uint32_t)((int32_t)12735)))))
 		{
-			goto IL_0039;
+			goto IL_01d3;
 		}
 	}
+
+IL_0030:
 	{
 		uint32_t L_5 = ___0_c;
-		if ((!(((uint32_t)L_5) > ((uint32_t)((int32_t)40959)))))
+		if ((!(((uint32_t)L_5) >= ((uint32_t)((int32_t)19968)))))
 		{
-			goto IL_01c9;
+			goto IL_0043;
 		}
 	}
-
-IL_0039:
 	{
 		uint32_t L_6 = ___0_c;
-		if ((!(((uint32_t)L_6) >= ((uint32_t)((int32_t)13312)))))
+		if ((!(((uint32_t)L_6) > ((uint32_t)((int32_t)40959)))))
 		{
-			goto IL_004c;
+			goto IL_01d3;
 		}
 	}
+
+IL_0043:
 	{
 		uint32_t L_7 = ___0_c;
-		if ((!(((uint32_t)L_7) > ((uint32_t)((int32_t)19903)))))
+		if ((!(((uint32_t)L_7) >= ((uint32_t)((int32_t)13312)))))
 		{
-			goto IL_01c9;
+			goto IL_0056;
 		}
 	}
-
-IL_004c:
 	{
 		uint32_t L_8 = ___0_c;
-		if ((!(((uint32_t)L_8) >= ((uint32_t)((int32_t)131072)))))
+		if ((!(((uint32_t)L_8) > ((uint32_t)((int32_t)19903)))))
 		{
-			goto IL_005f;
+			goto IL_01d3;
 		}
 	}
+
+IL_0056:
 	{
 		uint32_t L_9 = ___0_c;
-		if ((!(((uint32_t)L_9) > ((uint32_t)((int32_t)173791)))))
+		if ((!(((uint32_t)L_9) >= ((uint32_t)((int32_t)131072)))))
 		{
-			goto IL_01c9;
+			goto IL_0069;
 		}
 	}
-
-IL_005f:
 	{
 		uint32_t L_10 = ___0_c;
-		if ((!(((uint32_t)L_10) >= ((uint32_t)((int32_t)173824)))))
+		if ((!(((uint32_t)L_10) > ((uint32_t)((int32_t)173791)))))
 		{
-			goto IL_0072;
+			goto IL_01d3;
 		}
 	}
+
+IL_0069:
 	{
 		uint32_t L_11 = ___0_c;
-		if ((!(((uint32_t)L_11) > ((uint32_t)((int32_t)177983)))))
+		if ((!(((uint32_t)L_11) >= ((uint32_t)((int32_t)173824)))))
 		{
-			goto IL_01c9;
+			goto IL_007c;
 		}
 	}
-
-IL_0072:
 	{
 		uint32_t L_12 = ___0_c;
-		if ((!(((uint32_t)L_12) >= ((uint32_t)((int32_t)177984)))))
+		if ((!(((uint32_t)L_12) > ((uint32_t)((int32_t)177983)))))
 		{
-			goto IL_0085;
+			goto IL_01d3;
 		}
 	}
+
+IL_007c:
 	{
 		uint32_t L_13 = ___0_c;
-		if ((!(((uint32_t)L_13) > ((uint32_t)((int32_t)178207)))))
+		if ((!(((uint32_t)L_13) >= ((uint32_t)((int32_t)177984)))))
 		{
-			goto IL_01c9;
+			goto IL_008f;
 		}
 	}
-
-IL_0085:
 	{
 		uint32_t L_14 = ___0_c;
-		if ((!(((uint32_t)L_14) >= ((uint32_t)((int32_t)178208)))))
+		if ((!(((uint32_t)L_14) > ((uint32_t)((int32_t)178207)))))
 		{
-			goto IL_0098;
+			goto IL_01d3;
 		}
 	}
+
+IL_008f:
 	{
 		uint32_t L_15 = ___0_c;
-		if ((!(((uint32_t)L_15) > ((uint32_t)((int32_t)183983)))))
+		if ((!(((uint32_t)L_15) >= ((uint32_t)((int32_t)178208)))))
 		{
-			goto IL_01c9;
+			goto IL_00a2;
 		}
 	}
-
-IL_0098:
 	{
 		uint32_t L_16 = ___0_c;
-		if ((!(((uint32_t)L_16) >= ((uint32_t)((int32_t)183984)))))
+		if ((!(((uint32_t)L_16) > ((uint32_t)((int32_t)183983)))))
 		{
-			goto IL_00ab;
+			goto IL_01d3;
 		}
 	}
+
+IL_00a2:
 	{
 		uint32_t L_17 = ___0_c;
-		if ((!(((uint32_t)L_17) > ((uint32_t)((int32_t)191456)))))
+		if ((!(((uint32_t)L_17) >= ((uint32_t)((int32_t)183984)))))
 		{
-			goto IL_01c9;
+			goto IL_00b5;
 		}
 	}
-
-IL_00ab:
 	{
 		uint32_t L_18 = ___0_c;
-		if ((!(((uint32_t)L_18) >= ((uint32_t)((int32_t)196608)))))
+		if ((!(((uint32_t)L_18) > ((uint32_t)((int32_t)191456)))))
 		{
-			goto IL_00be;
+			goto IL_01d3;
 		}
 	}
+
+IL_00b5:
 	{
 		uint32_t L_19 = ___0_c;
-		if ((!(((uint32_t)L_19) > ((uint32_t)((int32_t)201546)))))
+		if ((!(((uint32_t)L_19) >= ((uint32_t)((int32_t)196608)))))
 		{
-			goto IL_01c9;
+			goto IL_00c8;
 		}
 	}
-
-IL_00be:
 	{
 		uint32_t L_20 = ___0_c;
-		if ((!(((uint32_t)L_20) >= ((uint32_t)((int32_t)63744)))))
+		if ((!(((uint32_t)L_20) > ((uint32_t)((int32_t)201546)))))
 		{
-			goto IL_00d1;
+			goto IL_01d3;
 		}
 	}
+
+IL_00c8:
 	{
 		uint32_t L_21 = ___0_c;
-		if ((!(((uint32_t)L_21) > ((uint32_t)((int32_t)64255)))))
+		if ((!(((uint32_t)L_21) >= ((uint32_t)((int32_t)63744)))))
 		{
-			goto IL_01c9;
+			goto IL_00db;
 		}
 	}
-
-IL_00d1:
 	{
 		uint32_t L_22 = ___0_c;
-		if ((!(((uint32_t)L_22) >= ((uint32_t)((int32_t)194560)))))
+		if ((!(((uint32_t)L_22) > ((uint32_t)((int32_t)64255)))))
 		{
-			goto IL_00e4;
+			goto IL_01d3;
 		}
 	}
+
+IL_00db:
 	{
 		uint32_t L_23 = ___0_c;
-		if ((!(((uint32_t)L_23) > ((uint32_t)((int32_t)195103)))))
+		if ((!(((uint32_t)L_23) >= ((uint32_t)((int32_t)194560)))))
 		{
-			goto IL_01c9;
+			goto IL_00ee;
 		}
 	}
-
-IL_00e4:
 	{
 		uint32_t L_24 = ___0_c;
-		if ((!(((uint32_t)L_24) >= ((uint32_t)((int32_t)12032)))))
+		if ((!(((uint32_t)L_24) > ((uint32_t)((int32_t)195103)))))
 		{
-			goto IL_00f7;
+			goto IL_01d3;
 		}
 	}
+
+IL_00ee:
 	{
 		uint32_t L_25 = ___0_c;
-		if ((!(((uint32_t)L_25) > ((uint32_t)((int32_t)12255)))))
+		if ((!(((uint32_t)L_25) >= ((uint32_t)((int32_t)12032)))))
 		{
-			goto IL_01c9;
+			goto IL_0101;
 		}
 	}
-
-IL_00f7:
 	{
 		uint32_t L_26 = ___0_c;
-		if ((!(((uint32_t)L_26) >= ((uint32_t)((int32_t)11904)))))
+		if ((!(((uint32_t)L_26) > ((uint32_t)((int32_t)12255)))))
 		{
-			goto IL_010a;
+			goto IL_01d3;
 		}
 	}
+
+IL_0101:
 	{
 		uint32_t L_27 = ___0_c;
-		if ((!(((uint32_t)L_27) > ((uint32_t)((int32_t)12031)))))
+		if ((!(((uint32_t)L_27) >= ((uint32_t)((int32_t)11904)))))
 		{
-			goto IL_01c9;
+			goto IL_0114;
 		}
 	}
-
-IL_010a:
 	{
 		uint32_t L_28 = ___0_c;
-		if ((!(((uint32_t)L_28) >= ((uint32_t)((int32_t)12736)))))
+		if ((!(((uint32_t)L_28) > ((uint32_t)((int32_t)12031)))))
 		{
-			goto IL_011d;
+			goto IL_01d3;
 		}
 	}
+
+IL_0114:
 	{
 		uint32_t L_29 = ___0_c;
-		if ((!(((uint32_t)L_29) > ((uint32_t)((int32_t)12783)))))
+		if ((!(((uint32_t)L_29) >= ((uint32_t)((int32_t)12736)))))
 		{
-			goto IL_01c9;
+			goto IL_0127;
 		}
 	}
-
-IL_011d:
 	{
 		uint32_t L_30 = ___0_c;
-		if ((!(((uint32_t)L_30) >= ((uint32_t)((int32_t)12272)))))
+		if ((!(((uint32_t)L_30) > ((uint32_t)((int32_t)12783)))))
 		{
-			goto IL_0130;
+			goto IL_01d3;
 		}
 	}
+
+IL_0127:
 	{
 		uint32_t L_31 = ___0_c;
-		if ((!(((uint32_t)L_31) > ((uint32_t)((int32_t)12287)))))
+		if ((!(((uint32_t)L_31) >= ((uint32_t)((int32_t)12272)))))
 		{
-			goto IL_01c9;
+			goto IL_013a;
 		}
 	}
-
-IL_0130:
 	{
 		uint32_t L_32 = ___0_c;
-		if ((!(((uint32_t)L_32) >= ((uint32_t)((int32_t)12352)))))
+		if ((!(((uint32_t)L_32) > ((uint32_t)((int32_t)12287)))))
 		{
-			goto IL_0143;
+			goto IL_01d3;
 		}
 	}
+
+IL_013a:
 	{
 		uint32_t L_33 = ___0_c;
-		if ((!(((uint32_t)L_33) > ((uint32_t)((int32_t)12447)))))
+		if ((!(((uint32_t)L_33) >= ((uint32_t)((int32_t)12352)))))
 		{
-			goto IL_01c9;
+			goto IL_014d;
 		}
 	}
-
-IL_0143:
 	{
 		uint32_t L_34 = ___0_c;
-		if ((!(((uint32_t)L_34) >= ((uint32_t)((int32_t)110848)))))
+		if ((!(((uint32_t)L_34) > ((uint32_t)((int32_t)12447)))))
 		{
-			goto IL_0153;
+			goto IL_01d3;
 		}
 	}
+
+IL_014d:
 	{
 		uint32_t L_35 = ___0_c;
-		if ((!(((uint32_t)L_35) > ((uint32_t)((int32_t)110895)))))
+		if ((!(((uint32_t)L_35) >= ((uint32_t)((int32_t)110848)))))
 		{
-			goto IL_01c9;
+			goto IL_015d;
 		}
 	}
-
-IL_0153:
 	{
 		uint32_t L_36 = ___0_c;
-		if ((!(((uint32_t)L_36) >= ((uint32_t)((int32_t)110576)))))
+		if ((!(((uint32_t)L_36) > ((uint32_t)((int32_t)110895)))))
 		{
-			goto IL_0163;
+			goto IL_01d3;
 		}
 	}
+
+IL_015d:
 	{
 		uint32_t L_37 = ___0_c;
-		if ((!(((uint32_t)L_37) > ((uint32_t)((int32_t)110591)))))
+		if ((!(((uint32_t)L_37) >= ((uint32_t)((int32_t)110576)))))
 		{
-			goto IL_01c9;
+			goto IL_016d;
 		}
 	}
-
-IL_0163:
 	{
 		uint32_t L_38 = ___0_c;
-		if ((!(((uint32_t)L_38) >= ((uint32_t)((int32_t)110592)))))
+		if ((!(((uint32_t)L_38) > ((uint32_t)((int32_t)110591)))))
 		{
-			goto IL_0173;
+			goto IL_01d3;
 		}
 	}
+
+IL_016d:
 	{
 		uint32_t L_39 = ___0_c;
-		if ((!(((uint32_t)L_39) > ((uint32_t)((int32_t)110847)))))
+		if ((!(((uint32_t)L_39) >= ((uint32_t)((int32_t)110592)))))
 		{
-			goto IL_01c9;
+			goto IL_017d;
 		}
 	}
-
-IL_0173:
 	{
 		uint32_t L_40 = ___0_c;
-		if ((!(((uint32_t)L_40) >= ((uint32_t)((int32_t)110896)))))
+		if ((!(((uint32_t)L_40) > ((uint32_t)((int32_t)110847)))))
 		{
-			goto IL_0183;
+			goto IL_01d3;
 		}
 	}
+
+IL_017d:
 	{
 		uint32_t L_41 = ___0_c;
-		if ((!(((uint32_t)L_41) > ((uint32_t)((int32_t)110959)))))
+		if ((!(((uint32_t)L_41) >= ((uint32_t)((int32_t)110896)))))
 		{
-			goto IL_01c9;
+			goto IL_018d;
 		}
 	}
-
-IL_0183:
 	{
 		uint32_t L_42 = ___0_c;
-		if ((!(((uint32_t)L_42) >= ((uint32_t)((int32_t)12688)))))
+		if ((!(((uint32_t)L_42) > ((uint32_t)((int32_t)110959)))))
 		{
-			goto IL_0193;
+			goto IL_01d3;
 		}
 	}
+
+IL_018d:
 	{
 		uint32_t L_43 = ___0_c;
-		if ((!(((uint32_t)L_43) > ((uint32_t)((int32_t)12703)))))
+		if ((!(((uint32_t)L_43) >= ((uint32_t)((int32_t)12688)))))
 		{
-			goto IL_01c9;
+			goto IL_019d;
 		}
 	}
-
-IL_0193:
 	{
 		uint32_t L_44 = ___0_c;
-		if ((!(((uint32_t)L_44) >= ((uint32_t)((int32_t)12448)))))
+		if ((!(((uint32_t)L_44) > ((uint32_t)((int32_t)12703)))))
 		{
-			goto IL_01a3;
+			goto IL_01d3;
 		}
 	}
+
+IL_019d:
 	{
 		uint32_t L_45 = ___0_c;
-		if ((!(((uint32_t)L_45) > ((uint32_t)((int32_t)12543)))))
+		if ((!(((uint32_t)L_45) >= ((uint32_t)((int32_t)12448)))))
 		{
-			goto IL_01c9;
+			goto IL_01ad;
 		}
 	}
-
-IL_01a3:
 	{
 		uint32_t L_46 = ___0_c;
-		if ((!(((uint32_t)L_46) >= ((uint32_t)((int32_t)12784)))))
+		if ((!(((uint32_t)L_46) > ((uint32_t)((int32_t)12543)))))
 		{
-			goto IL_01b3;
+			goto IL_01d3;
 		}
 	}
+
+IL_01ad:
 	{
 		uint32_t L_47 = ___0_c;
-		if ((!(((uint32_t)L_47) > ((uint32_t)((int32_t)12799)))))
+		if ((!(((uint32_t)L_47) >= ((uint32_t)((int32_t)12784)))))
 		{
-			goto IL_01c9;
+			goto IL_01bd;
 		}
 	}
-
-IL_01b3:
 	{
 		uint32_t L_48 = ___0_c;
-		if ((!(((uint32_t)L_48) >= ((uint32_t)((int32_t)65381)))))
+		if ((!(((uint32_t)L_48) > ((uint32_t)((int32_t)12799)))))
 		{
-			goto IL_01c7;
+			goto IL_01d3;
 		}
 	}
+
+IL_01bd:
 	{
 		uint32_t L_49 = ___0_c;
-		return (bool)((((int32_t)((!(((uint32_t)L_49) <= ((uint32_t)((int32_t)65439))))? 1 : 0)) == ((int32_t)0))? 1 : 0);
+		if ((!(((uint32_t)L_49) >= ((uint32_t)((int32_t)65381)))))
+		{
+			goto IL_01d1;
+		}
+	}
+	{
+		uint32_t L_50 = ___0_c;
+		return (bool)((((int32_t)((!(((uint32_t)L_50) <= ((uint32_t)((int32_t)65439))))? 1 : 0)) == ((int32_t)0))? 1 : 0);
 	}
 
-IL_01c7:
+IL_01d1:
 	{
 		return (bool)0;
 	}
 
-IL_01c9:
+IL_01d3:
 	{
 		return (bool)1;
 	}
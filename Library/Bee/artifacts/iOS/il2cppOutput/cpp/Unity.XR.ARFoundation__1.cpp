@@ -8415,7 +8415,14 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void ARPlaneManager_OnTrackablesChanged_m5B10
 		L_0 = ARTrackableManager_5_get_trackablesChanged_mEA792ECD1F4E2A630399968877A7C86FFEB43B11_inline(__this, ARTrackableManager_5_get_trackablesChanged_mEA792ECD1F4E2A630399968877A7C86FFEB43B11_RuntimeMethod_var);
 		if (!L_0)
 		{
-			goto IL_003d;
+			goto IL_0045;
+		}
+	}
+	{
+		Action_1_t009680BF19017ECA60753C7F605CBD85C56C6560* L_1 = __this->___planesChanged;
+		if (!L_1)
+		{
+			goto IL_0045;
 		}
 	}
 	{
@@ -8425,7 +8432,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void ARPlaneManager_OnTrackablesChanged_m5B10
 		auto __finallyBlock = il2cpp::utils::Finally([&]
 		{
 
-FINALLY_002f:
+FINALLY_0037:
 			{
 				ScopedProfiler_Dispose_m7B646405B4E52CC4677329D3B860BE9C17A9DAC4((&V_0), NULL);
 				return;
@@ -8434,30 +8441,30 @@ FINALLY_002f:
 		try
 		{
 			{
-				Action_1_t009680BF19017ECA60753C7F605CBD85C56C6560* L_1 = __this->___planesChanged;
-				Action_1_t009680BF19017ECA60753C7F605CBD85C56C6560* L_2 = L_1;
-				if (L_2)
+				Action_1_t009680BF19017ECA60753C7F605CBD85C56C6560* L_2 = __this->___planesChanged;
+				Action_1_t009680BF19017ECA60753C7F605CBD85C56C6560* L_3 = L_2;
+				if (L_3)
 				{
-					G_B4_0 = L_2;
-					goto IL_0020_1;
+					G_B4_0 = L_3;
+					goto IL_0028_1;
 				}
-				G_B3_0 = L_2;
+				G_B3_0 = L_3;
 			}
 			{
-				goto IL_003d;
+				goto IL_0045;
 			}
 
-IL_0020_1:
+IL_0028_1:
 			{
-				List_1_t10BA05B555C92BD54800DFF82DCAAFC9DE44A077* L_3 = ___0_added;
-				List_1_t10BA05B555C92BD54800DFF82DCAAFC9DE44A077* L_4 = ___1_updated;
-				List_1_t10BA05B555C92BD54800DFF82DCAAFC9DE44A077* L_5 = ___2_removed;
-				ARPlanesChangedEventArgs_t8D63E0257BF9942EF8F8C0445F2FD46421017872 L_6;
-				memset((&L_6), 0, sizeof(L_6));
-				ARPlanesChangedEventArgs__ctor_m20AE62576EED835E5930101056E72092B75CA2F3((&L_6), L_3, L_4, L_5, NULL);
+				List_1_t10BA05B555C92BD54800DFF82DCAAFC9DE44A077* L_4 = ___0_added;
+				List_1_t10BA05B555C92BD54800DFF82DCAAFC9DE44A077* L_5 = ___1_updated;
+				List_1_t10BA05B555C92BD54800DFF82DCAAFC9DE44A077* L_6 = ___2_removed;
+				ARPlanesChangedEventArgs_t8D63E0257BF9942EF8F8C0445F2FD46421017872 L_7;
+				memset((&L_7), 0, sizeof(L_7));
+				ARPlanesChangedEventArgs__ctor_m20AE62576EED835E5930101056E72092B75CA2F3((&L_7), L_4, L_5, L_6, NULL);
 				NullCheck(G_B4_0);
-				Action_1_Invoke_m2F4F409226EFAA2B6A0B31F761BAD4417A669DF6_inline(G_B4_0, L_6, NULL);
-				goto IL_003d;
+				Action_1_Invoke_m2F4F409226EFAA2B6A0B31F761BAD4417A669DF6_inline(G_B4_0, L_7, NULL);
+				goto IL_0045;
 			}
 		}
 		catch(Il2CppExceptionWrapper& e)
@@ -8466,7 +8473,7 @@ IL_0020_1:
 		}
 	}
 
-IL_003d:
+IL_0045:
 	{
 		return;
 	}
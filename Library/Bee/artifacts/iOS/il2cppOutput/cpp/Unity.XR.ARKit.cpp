@@ -21210,7 +21210,7 @@ IL_002f_1:
 				int32_t L_14 = ___1_allocator;
 				NativeArray_1_tE3A71FEF49167DCD4DEFE7E6EF990295BB1F2E30 L_15;
 				memset((&L_15), 0, sizeof(L_15));
-				NativeArray_1__ctor_m319820409AE7B98E69673D286E2A74F1A28A0E17((&L_15), L_13, L_14, 1, NativeArray_1__ctor_m319820409AE7B98E69673D286E2A74F1A28A0E17_RuntimeMethod_var);
+				NativeArray_1__ctor_m319820409AE7B98E69673D286E2A74F1A28A0E17((&L_15), L_13, L_14, 0, NativeArray_1__ctor_m319820409AE7B98E69673D286E2A74F1A28A0E17_RuntimeMethod_var);
 				*(NativeArray_1_tE3A71FEF49167DCD4DEFE7E6EF990295BB1F2E30*)L_12 = L_15;
 			}
 
@@ -10292,7 +10292,6 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool GeometryUtils_PointInPolygon_mCF3A7FF888
 	if (!s_Il2CppMethodInitialized)
 	{
 		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_RuntimeMethod_var);
-		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
 		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&MathUtility_tA05365A100CA63FA1E5AD0521555A4D74CEF85B6_il2cpp_TypeInfo_var);
 		s_Il2CppMethodInitialized = true;
 	}
@@ -10309,6 +10308,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool GeometryUtils_PointInPolygon_mCF3A7FF888
 	memset((&V_7), 0, sizeof(V_7));
 	float V_8 = 0.0f;
 	bool V_9 = false;
+	Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* V_10 = NULL;
+	int32_t V_11 = 0;
 	{
 		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_0 = ___1_vertices;
 		NullCheck(L_0);
@@ -10328,13 +10329,12 @@ IL_000b:
 		V_0 = 0;
 		V_1 = 0;
 		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_2 = ___1_vertices;
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_3 = ___1_vertices;
-		NullCheck(L_3);
-		int32_t L_4;
-		L_4 = List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_inline(L_3, List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_RuntimeMethod_var);
 		NullCheck(L_2);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_5;
-		L_5 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_2, ((int32_t)il2cpp_codegen_subtract(L_4, 1)), List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
+		V_10 = L_2->____items;
+		int32_t L_3 = L_2->____size;
+		V_11 = L_3;
+		int32_t L_4 = V_11;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_5 = (V_10)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_subtract(L_4, 1))));
 		V_2 = L_5;
 		float* L_6 = (float*)(&(&V_2)->___x);
 		float* L_7 = L_6;
@@ -10368,52 +10368,45 @@ IL_000b:
 
 IL_0062:
 	{
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_21 = ___1_vertices;
-		NullCheck(L_21);
-		int32_t L_22;
-		L_22 = List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_inline(L_21, List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_RuntimeMethod_var);
-		V_4 = ((int32_t)il2cpp_codegen_subtract(L_22, 2));
+		int32_t L_21 = V_11;
+		V_4 = ((int32_t)il2cpp_codegen_subtract(L_21, 2));
 		goto IL_00a6;
 	}
 
 IL_006e:
 	{
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_23 = ___1_vertices;
-		int32_t L_24 = V_4;
-		NullCheck(L_23);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_25;
-		L_25 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_23, L_24, List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
+		int32_t L_22 = V_4;
+		float L_23 = (V_10)->GetAddressAtUnchecked(static_cast<il2cpp_array_size_t>(L_22))->___z;
+		V_5 = L_23;
+		float L_24 = V_5;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_25 = ___0_testPoint;
 		float L_26 = L_25.___z;
-		V_5 = L_26;
+		V_5 = ((float)il2cpp_codegen_subtract(L_24, L_26));
 		float L_27 = V_5;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_28 = ___0_testPoint;
-		float L_29 = L_28.___z;
-		V_5 = ((float)il2cpp_codegen_subtract(L_27, L_29));
-		float L_30 = V_5;
 		il2cpp_codegen_runtime_class_init_inline(MathUtility_tA05365A100CA63FA1E5AD0521555A4D74CEF85B6_il2cpp_TypeInfo_var);
-		bool L_31;
-		L_31 = MathUtility_ApproximatelyZero_m4F8E97EAD2F5CCA7D30599B685C9393875E7656D_inline(L_30, NULL);
-		if (L_31)
+		bool L_28;
+		L_28 = MathUtility_ApproximatelyZero_m4F8E97EAD2F5CCA7D30599B685C9393875E7656D_inline(L_27, NULL);
+		if (L_28)
 		{
 			goto IL_00a0;
 		}
 	}
 	{
-		float L_32 = V_5;
-		V_3 = (bool)((((float)L_32) < ((float)(0.0f)))? 1 : 0);
+		float L_29 = V_5;
+		V_3 = (bool)((((float)L_29) < ((float)(0.0f)))? 1 : 0);
 		goto IL_0191;
 	}
 
 IL_00a0:
 	{
-		int32_t L_33 = V_4;
-		V_4 = ((int32_t)il2cpp_codegen_subtract(L_33, 1));
+		int32_t L_30 = V_4;
+		V_4 = ((int32_t)il2cpp_codegen_subtract(L_30, 1));
 	}
 
 IL_00a6:
 	{
-		int32_t L_34 = V_4;
-		if ((((int32_t)L_34) >= ((int32_t)0)))
+		int32_t L_31 = V_4;
+		if ((((int32_t)L_31) >= ((int32_t)0)))
 		{
 			goto IL_006e;
 		}
@@ -10424,62 +10417,59 @@ IL_00a6:
 
 IL_00b0:
 	{
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_35 = ___1_vertices;
-		int32_t L_36 = V_1;
-		NullCheck(L_35);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_37;
-		L_37 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_35, L_36, List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
-		V_6 = L_37;
-		float* L_38 = (float*)(&(&V_6)->___x);
-		float* L_39 = L_38;
-		float L_40 = *((float*)L_39);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_41 = ___0_testPoint;
-		float L_42 = L_41.___x;
-		*((float*)L_39) = (float)((float)il2cpp_codegen_subtract(L_40, L_42));
-		float* L_43 = (float*)(&(&V_6)->___z);
-		float* L_44 = L_43;
-		float L_45 = *((float*)L_44);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_46 = ___0_testPoint;
-		float L_47 = L_46.___z;
-		*((float*)L_44) = (float)((float)il2cpp_codegen_subtract(L_45, L_47));
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_48 = V_6;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_49 = V_2;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_50;
-		L_50 = Vector3_op_Subtraction_mE42023FF80067CB44A1D4A27EB7CF2B24CABB828_inline(L_48, L_49, NULL);
-		V_7 = L_50;
-		float L_51;
-		L_51 = Vector3_get_sqrMagnitude_m43C27DEC47C4811FB30AB474FF2131A963B66FC8_inline((&V_7), NULL);
-		V_8 = L_51;
+		int32_t L_32 = V_1;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_33 = (V_10)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(L_32));
+		V_6 = L_33;
+		float* L_34 = (float*)(&(&V_6)->___x);
+		float* L_35 = L_34;
+		float L_36 = *((float*)L_35);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_37 = ___0_testPoint;
+		float L_38 = L_37.___x;
+		*((float*)L_35) = (float)((float)il2cpp_codegen_subtract(L_36, L_38));
+		float* L_39 = (float*)(&(&V_6)->___z);
+		float* L_40 = L_39;
+		float L_41 = *((float*)L_40);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_42 = ___0_testPoint;
+		float L_43 = L_42.___z;
+		*((float*)L_40) = (float)((float)il2cpp_codegen_subtract(L_41, L_43));
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_44 = V_6;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_45 = V_2;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_46;
+		L_46 = Vector3_op_Subtraction_mE42023FF80067CB44A1D4A27EB7CF2B24CABB828_inline(L_44, L_45, NULL);
+		V_7 = L_46;
+		float L_47;
+		L_47 = Vector3_get_sqrMagnitude_m43C27DEC47C4811FB30AB474FF2131A963B66FC8_inline((&V_7), NULL);
+		V_8 = L_47;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_48 = V_7;
+		float L_49 = L_48.___x;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_50 = V_6;
+		float L_51 = L_50.___z;
 		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_52 = V_7;
-		float L_53 = L_52.___x;
+		float L_53 = L_52.___z;
 		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_54 = V_6;
-		float L_55 = L_54.___z;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_56 = V_7;
-		float L_57 = L_56.___z;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_58 = V_6;
-		float L_59 = L_58.___x;
+		float L_55 = L_54.___x;
 		il2cpp_codegen_runtime_class_init_inline(MathUtility_tA05365A100CA63FA1E5AD0521555A4D74CEF85B6_il2cpp_TypeInfo_var);
-		bool L_60;
-		L_60 = MathUtility_ApproximatelyZero_m4F8E97EAD2F5CCA7D30599B685C9393875E7656D_inline(((float)il2cpp_codegen_subtract(((float)il2cpp_codegen_multiply(L_53, L_55)), ((float)il2cpp_codegen_multiply(L_57, L_59)))), NULL);
-		if (!L_60)
+		bool L_56;
+		L_56 = MathUtility_ApproximatelyZero_m4F8E97EAD2F5CCA7D30599B685C9393875E7656D_inline(((float)il2cpp_codegen_subtract(((float)il2cpp_codegen_multiply(L_49, L_51)), ((float)il2cpp_codegen_multiply(L_53, L_55)))), NULL);
+		if (!L_56)
 		{
 			goto IL_012c;
 		}
 	}
 	{
-		float L_61;
-		L_61 = Vector3_get_sqrMagnitude_m43C27DEC47C4811FB30AB474FF2131A963B66FC8_inline((&V_2), NULL);
-		float L_62 = V_8;
-		if ((!(((float)L_61) <= ((float)L_62))))
+		float L_57;
+		L_57 = Vector3_get_sqrMagnitude_m43C27DEC47C4811FB30AB474FF2131A963B66FC8_inline((&V_2), NULL);
+		float L_58 = V_8;
+		if ((!(((float)L_57) <= ((float)L_58))))
 		{
 			goto IL_012c;
 		}
 	}
 	{
-		float L_63;
-		L_63 = Vector3_get_sqrMagnitude_m43C27DEC47C4811FB30AB474FF2131A963B66FC8_inline((&V_6), NULL);
-		float L_64 = V_8;
-		if ((!(((float)L_63) <= ((float)L_64))))
+		float L_59;
+		L_59 = Vector3_get_sqrMagnitude_m43C27DEC47C4811FB30AB474FF2131A963B66FC8_inline((&V_6), NULL);
+		float L_60 = V_8;
+		if ((!(((float)L_59) <= ((float)L_60))))
 		{
 			goto IL_012c;
 		}
@@ -10490,75 +10480,72 @@ IL_00b0:
 
 IL_012c:
 	{
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_65 = V_6;
-		float L_66 = L_65.___z;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_61 = V_6;
+		float L_62 = L_61.___z;
 		il2cpp_codegen_runtime_class_init_inline(MathUtility_tA05365A100CA63FA1E5AD0521555A4D74CEF85B6_il2cpp_TypeInfo_var);
-		bool L_67;
-		L_67 = MathUtility_ApproximatelyZero_m4F8E97EAD2F5CCA7D30599B685C9393875E7656D_inline(L_66, NULL);
-		if (L_67)
+		bool L_63;
+		L_63 = MathUtility_ApproximatelyZero_m4F8E97EAD2F5CCA7D30599B685C9393875E7656D_inline(L_62, NULL);
+		if (L_63)
 		{
 			goto IL_018a;
 		}
 	}
 	{
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_68 = V_6;
-		float L_69 = L_68.___z;
-		V_9 = (bool)((((float)L_69) < ((float)(0.0f)))? 1 : 0);
-		bool L_70 = V_9;
-		bool L_71 = V_3;
-		if ((((int32_t)L_70) == ((int32_t)L_71)))
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_64 = V_6;
+		float L_65 = L_64.___z;
+		V_9 = (bool)((((float)L_65) < ((float)(0.0f)))? 1 : 0);
+		bool L_66 = V_9;
+		bool L_67 = V_3;
+		if ((((int32_t)L_66) == ((int32_t)L_67)))
 		{
 			goto IL_018a;
 		}
 	}
 	{
-		bool L_72 = V_9;
-		V_3 = L_72;
+		bool L_68 = V_9;
+		V_3 = L_68;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_69 = V_2;
+		float L_70 = L_69.___x;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_71 = V_6;
+		float L_72 = L_71.___z;
 		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_73 = V_2;
-		float L_74 = L_73.___x;
+		float L_74 = L_73.___z;
 		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_75 = V_6;
-		float L_76 = L_75.___z;
+		float L_76 = L_75.___x;
 		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_77 = V_2;
 		float L_78 = L_77.___z;
 		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_79 = V_6;
-		float L_80 = L_79.___x;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_81 = V_2;
-		float L_82 = L_81.___z;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_83 = V_6;
-		float L_84 = L_83.___z;
-		if ((!(((float)((float)(((float)il2cpp_codegen_subtract(((float)il2cpp_codegen_multiply(L_74, L_76)), ((float)il2cpp_codegen_multiply(L_78, L_80))))/((-((float)il2cpp_codegen_subtract(L_82, L_84))))))) > ((float)(0.0f)))))
+		float L_80 = L_79.___z;
+		if ((!(((float)((float)(((float)il2cpp_codegen_subtract(((float)il2cpp_codegen_multiply(L_70, L_72)), ((float)il2cpp_codegen_multiply(L_74, L_76))))/((-((float)il2cpp_codegen_subtract(L_78, L_80))))))) > ((float)(0.0f)))))
 		{
 			goto IL_018a;
 		}
 	}
 	{
-		int32_t L_85 = V_0;
-		V_0 = ((int32_t)il2cpp_codegen_add(L_85, 1));
+		int32_t L_81 = V_0;
+		V_0 = ((int32_t)il2cpp_codegen_add(L_81, 1));
 	}
 
 IL_018a:
 	{
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_86 = V_6;
-		V_2 = L_86;
-		int32_t L_87 = V_1;
-		V_1 = ((int32_t)il2cpp_codegen_add(L_87, 1));
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_82 = V_6;
+		V_2 = L_82;
+		int32_t L_83 = V_1;
+		V_1 = ((int32_t)il2cpp_codegen_add(L_83, 1));
 	}
 
 IL_0191:
 	{
-		int32_t L_88 = V_1;
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_89 = ___1_vertices;
-		NullCheck(L_89);
-		int32_t L_90;
-		L_90 = List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_inline(L_89, List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_RuntimeMethod_var);
-		if ((((int32_t)L_88) < ((int32_t)L_90)))
+		int32_t L_84 = V_1;
+		int32_t L_85 = V_11;
+		if ((((int32_t)L_84) < ((int32_t)L_85)))
 		{
 			goto IL_00b0;
 		}
 	}
 	{
-		int32_t L_91 = V_0;
-		return (bool)((((int32_t)((int32_t)(L_91%2))) > ((int32_t)0))? 1 : 0);
+		int32_t L_86 = V_0;
+		return (bool)((((int32_t)((int32_t)(L_86%2))) > ((int32_t)0))? 1 : 0);
 	}
 }
 IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool GeometryUtils_PointInPolygon3D_mE7254C77814EEF7920165E26B57587C29B0AC45F (Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 ___0_testPoint, List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* ___1_vertices, const RuntimeMethod* method) 
@@ -11061,12 +11048,14 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A
 	double V_8 = 0.0;
 	int32_t V_9 = 0;
 	double V_10 = 0.0;
+	Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* V_11 = NULL;
 	{
 		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_0 = ___0_vertices;
 		NullCheck(L_0);
 		int32_t L_1;
 		L_1 = List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_inline(L_0, List_1_get_Count_m46EEFFA770BE665EA0CB3A5332E941DA4B3C1D37_RuntimeMethod_var);
 		V_0 = L_1;
+		V_11 = L_0->____items;
 		V_2 = (0.0);
 		V_3 = (0.0);
 		V_4 = (0.0);
@@ -11076,111 +11065,103 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A
 
 IL_002b:
 	{
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_2 = ___0_vertices;
-		int32_t L_3 = V_9;
-		NullCheck(L_2);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_4;
-		L_4 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_2, L_3, List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_5 = L_4;
-		float L_6 = L_5.___x;
-		V_5 = ((double)L_6);
-		float L_7 = L_5.___z;
-		V_6 = ((double)L_7);
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_8 = ___0_vertices;
-		int32_t L_9 = V_9;
-		NullCheck(L_8);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_10;
-		L_10 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_8, ((int32_t)il2cpp_codegen_add(L_9, 1)), List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_11 = L_10;
-		float L_12 = L_11.___x;
-		V_7 = ((double)L_12);
-		float L_13 = L_11.___z;
-		V_8 = ((double)L_13);
-		double L_14 = V_5;
-		double L_15 = V_8;
-		double L_16 = V_7;
-		double L_17 = V_6;
-		V_1 = ((double)il2cpp_codegen_subtract(((double)il2cpp_codegen_multiply(L_14, L_15)), ((double)il2cpp_codegen_multiply(L_16, L_17))));
-		double L_18 = V_2;
+		int32_t L_2 = V_9;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_3 = (V_11)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(L_2));
+		float L_4 = L_3.___x;
+		V_5 = ((double)L_4);
+		float L_5 = L_3.___z;
+		V_6 = ((double)L_5);
+		int32_t L_6 = V_9;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_7 = (V_11)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(((int32_t)il2cpp_codegen_add(L_6, 1))));
+		float L_8 = L_7.___x;
+		V_7 = ((double)L_8);
+		float L_9 = L_7.___z;
+		V_8 = ((double)L_9);
+		double L_10 = V_5;
+		double L_11 = V_8;
+		double L_12 = V_7;
+		double L_13 = V_6;
+		V_1 = ((double)il2cpp_codegen_subtract(((double)il2cpp_codegen_multiply(L_10, L_11)), ((double)il2cpp_codegen_multiply(L_12, L_13))));
+		double L_14 = V_2;
+		double L_15 = V_1;
+		V_2 = ((double)il2cpp_codegen_add(L_14, L_15));
+		double L_16 = V_3;
+		double L_17 = V_5;
+		double L_18 = V_7;
 		double L_19 = V_1;
-		V_2 = ((double)il2cpp_codegen_add(L_18, L_19));
-		double L_20 = V_3;
-		double L_21 = V_5;
-		double L_22 = V_7;
+		V_3 = ((double)il2cpp_codegen_add(L_16, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_17, L_18)), L_19))));
+		double L_20 = V_4;
+		double L_21 = V_6;
+		double L_22 = V_8;
 		double L_23 = V_1;
-		V_3 = ((double)il2cpp_codegen_add(L_20, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_21, L_22)), L_23))));
-		double L_24 = V_4;
-		double L_25 = V_6;
-		double L_26 = V_8;
-		double L_27 = V_1;
-		V_4 = ((double)il2cpp_codegen_add(L_24, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_25, L_26)), L_27))));
-		int32_t L_28 = V_9;
-		V_9 = ((int32_t)il2cpp_codegen_add(L_28, 1));
+		V_4 = ((double)il2cpp_codegen_add(L_20, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_21, L_22)), L_23))));
+		int32_t L_24 = V_9;
+		V_9 = ((int32_t)il2cpp_codegen_add(L_24, 1));
 	}
 
 IL_008b:
 	{
-		int32_t L_29 = V_9;
-		int32_t L_30 = V_0;
-		if ((((int32_t)L_29) < ((int32_t)((int32_t)il2cpp_codegen_subtract(L_30, 1)))))
+		int32_t L_25 = V_9;
+		int32_t L_26 = V_0;
+		if ((((int32_t)L_25) < ((int32_t)((int32_t)il2cpp_codegen_subtract(L_26, 1)))))
 		{
 			goto IL_002b;
 		}
 	}
 	{
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_31 = ___0_vertices;
-		int32_t L_32 = V_9;
-		NullCheck(L_31);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_33;
-		L_33 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_31, L_32, List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_34 = L_33;
-		float L_35 = L_34.___x;
-		V_5 = ((double)L_35);
-		float L_36 = L_34.___z;
-		V_6 = ((double)L_36);
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_37 = ___0_vertices;
-		NullCheck(L_37);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_38;
-		L_38 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_37, 0, List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_39 = L_38;
-		float L_40 = L_39.___x;
-		V_7 = ((double)L_40);
-		float L_41 = L_39.___z;
-		V_8 = ((double)L_41);
-		double L_42 = V_5;
-		double L_43 = V_8;
-		double L_44 = V_7;
-		double L_45 = V_6;
-		V_1 = ((double)il2cpp_codegen_subtract(((double)il2cpp_codegen_multiply(L_42, L_43)), ((double)il2cpp_codegen_multiply(L_44, L_45))));
-		double L_46 = V_2;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_27 = ___0_vertices;
+		int32_t L_28 = V_9;
+		NullCheck(L_27);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_29;
+		L_29 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_27, L_28, List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_30 = L_29;
+		float L_31 = L_30.___x;
+		V_5 = ((double)L_31);
+		float L_32 = L_30.___z;
+		V_6 = ((double)L_32);
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_33 = ___0_vertices;
+		NullCheck(L_33);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_34;
+		L_34 = List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810(L_33, 0, List_1_get_Item_m8F2E15FC96DA75186C51228128A0660709E4E810_RuntimeMethod_var);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_35 = L_34;
+		float L_36 = L_35.___x;
+		V_7 = ((double)L_36);
+		float L_37 = L_35.___z;
+		V_8 = ((double)L_37);
+		double L_38 = V_5;
+		double L_39 = V_8;
+		double L_40 = V_7;
+		double L_41 = V_6;
+		V_1 = ((double)il2cpp_codegen_subtract(((double)il2cpp_codegen_multiply(L_38, L_39)), ((double)il2cpp_codegen_multiply(L_40, L_41))));
+		double L_42 = V_2;
+		double L_43 = V_1;
+		V_2 = ((double)il2cpp_codegen_add(L_42, L_43));
+		double L_44 = V_3;
+		double L_45 = V_5;
+		double L_46 = V_7;
 		double L_47 = V_1;
-		V_2 = ((double)il2cpp_codegen_add(L_46, L_47));
-		double L_48 = V_3;
-		double L_49 = V_5;
-		double L_50 = V_7;
+		V_3 = ((double)il2cpp_codegen_add(L_44, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_45, L_46)), L_47))));
+		double L_48 = V_4;
+		double L_49 = V_6;
+		double L_50 = V_8;
 		double L_51 = V_1;
-		V_3 = ((double)il2cpp_codegen_add(L_48, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_49, L_50)), L_51))));
-		double L_52 = V_4;
-		double L_53 = V_6;
-		double L_54 = V_8;
-		double L_55 = V_1;
-		V_4 = ((double)il2cpp_codegen_add(L_52, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_53, L_54)), L_55))));
-		double L_56 = V_2;
-		V_2 = ((double)il2cpp_codegen_multiply(L_56, (0.5)));
-		double L_57 = V_2;
-		V_10 = ((double)il2cpp_codegen_multiply((6.0), L_57));
+		V_4 = ((double)il2cpp_codegen_add(L_48, ((double)il2cpp_codegen_multiply(((double)il2cpp_codegen_add(L_49, L_50)), L_51))));
+		double L_52 = V_2;
+		V_2 = ((double)il2cpp_codegen_multiply(L_52, (0.5)));
+		double L_53 = V_2;
+		V_10 = ((double)il2cpp_codegen_multiply((6.0), L_53));
+		double L_54 = V_3;
+		double L_55 = V_10;
+		V_3 = ((double)(L_54/L_55));
+		double L_56 = V_4;
+		double L_57 = V_10;
+		V_4 = ((double)(L_56/L_57));
 		double L_58 = V_3;
-		double L_59 = V_10;
-		V_3 = ((double)(L_58/L_59));
-		double L_60 = V_4;
-		double L_61 = V_10;
-		V_4 = ((double)(L_60/L_61));
-		double L_62 = V_3;
-		double L_63 = V_4;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_64;
-		memset((&L_64), 0, sizeof(L_64));
-		Vector3__ctor_m376936E6B999EF1ECBE57D990A386303E2283DE0_inline((&L_64), ((float)L_62), (0.0f), ((float)L_63), NULL);
-		return L_64;
+		double L_59 = V_4;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_60;
+		memset((&L_60), 0, sizeof(L_60));
+		Vector3__ctor_m376936E6B999EF1ECBE57D990A386303E2283DE0_inline((&L_60), ((float)L_58), (0.0f), ((float)L_59), NULL);
+		return L_60;
 	}
 }
 IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 GeometryUtils_OrientedMinimumBoundingBox2D_mE8CA374604AE77B405C0E458C2A54B7B06313DCF (List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* ___0_convexHull, Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* ___1_boundingBox, const RuntimeMethod* method) 
@@ -12247,44 +12228,220 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool GeometryUtils_PolygonsWithinSqRange_m0EE
 	memset((&V_0), 0, sizeof(V_0));
 	Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 V_1;
 	memset((&V_1), 0, sizeof(V_1));
+	Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* V_2 = NULL;
+	Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* V_3 = NULL;
+	int32_t V_4 = 0;
+	int32_t V_5 = 0;
+	int32_t V_6 = 0;
+	Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 V_7;
+	memset((&V_7), 0, sizeof(V_7));
+	Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 V_8;
+	memset((&V_8), 0, sizeof(V_8));
+	Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 V_9;
+	memset((&V_9), 0, sizeof(V_9));
+	Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 V_10;
+	memset((&V_10), 0, sizeof(V_10));
 	{
 		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_0 = ___0_polygonA;
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_1 = ___1_polygonB;
+		NullCheck(L_0);
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_1 = L_0->____items;
+		V_2 = L_1;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_2 = ___0_polygonA;
+		NullCheck(L_2);
+		int32_t L_3 = L_2->____size;
+		V_4 = L_3;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_4 = ___1_polygonB;
+		NullCheck(L_4);
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_5 = L_4->____items;
+		V_3 = L_5;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_6 = ___1_polygonB;
+		NullCheck(L_6);
+		int32_t L_7 = L_6->____size;
+		V_5 = L_7;
+		int32_t L_8 = V_4;
+		if ((((int32_t)L_8) < ((int32_t)2)))
+		{
+			goto IL_00e7;
+		}
+	}
+	{
+		int32_t L_9 = V_5;
+		if ((((int32_t)L_9) < ((int32_t)2)))
+		{
+			goto IL_00e7;
+		}
+	}
+	{
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_10 = V_2;
+		NullCheck(L_10);
+		int32_t L_11 = 0;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_12 = (L_10)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(L_11));
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_13 = L_12;
+		V_7 = L_13;
+		V_8 = L_13;
+		V_6 = 1;
+		goto IL_005f;
+	}
+
+IL_0037:
+	{
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_14 = V_2;
+		int32_t L_15 = V_6;
+		NullCheck(L_14);
+		int32_t L_16 = L_15;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_17 = (L_14)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(L_16));
+		V_0 = L_17;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_18 = V_7;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_19 = V_0;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_20;
+		L_20 = Vector3_Min_m1CAC3499F14EA87366C0C3C1F501B4FB2863CDB4_inline(L_18, L_19, NULL);
+		V_7 = L_20;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_21 = V_8;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_22 = V_0;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_23;
+		L_23 = Vector3_Max_m9B6D8FEE7F4CE32C0AAB682606FFBA59E1F37C74_inline(L_21, L_22, NULL);
+		V_8 = L_23;
+		int32_t L_24 = V_6;
+		V_6 = ((int32_t)il2cpp_codegen_add(L_24, 1));
+	}
+
+IL_005f:
+	{
+		int32_t L_25 = V_6;
+		int32_t L_26 = V_4;
+		if ((((int32_t)L_25) < ((int32_t)L_26)))
+		{
+			goto IL_0037;
+		}
+	}
+	{
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_27 = V_3;
+		NullCheck(L_27);
+		int32_t L_28 = 0;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_29 = (L_27)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(L_28));
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_30 = L_29;
+		V_9 = L_30;
+		V_10 = L_30;
+		V_6 = 1;
+		goto IL_00a2;
+	}
+
+IL_007a:
+	{
+		Vector3U5BU5D_tFF1859CCE176131B909E2044F76443064254679C* L_31 = V_3;
+		int32_t L_32 = V_6;
+		NullCheck(L_31);
+		int32_t L_33 = L_32;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_34 = (L_31)->GetAtUnchecked(static_cast<il2cpp_array_size_t>(L_33));
+		V_0 = L_34;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_35 = V_9;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_36 = V_0;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_37;
+		L_37 = Vector3_Min_m1CAC3499F14EA87366C0C3C1F501B4FB2863CDB4_inline(L_35, L_36, NULL);
+		V_9 = L_37;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_38 = V_10;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_39 = V_0;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_40;
+		L_40 = Vector3_Max_m9B6D8FEE7F4CE32C0AAB682606FFBA59E1F37C74_inline(L_38, L_39, NULL);
+		V_10 = L_40;
+		int32_t L_41 = V_6;
+		V_6 = ((int32_t)il2cpp_codegen_add(L_41, 1));
+	}
+
+IL_00a2:
+	{
+		int32_t L_42 = V_6;
+		int32_t L_43 = V_5;
+		if ((((int32_t)L_42) < ((int32_t)L_43)))
+		{
+			goto IL_007a;
+		}
+	}
+	{
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_44 = V_7;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_45 = V_8;
+		bool L_46;
+		L_46 = Vector3_op_Equality_mCDCBB8D2EDC3D3BF20F31A25ACB34705D352B479_inline(L_44, L_45, NULL);
+		if (L_46)
+		{
+			goto IL_00e7;
+		}
+	}
+	{
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_47 = V_9;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_48 = V_10;
+		bool L_49;
+		L_49 = Vector3_op_Equality_mCDCBB8D2EDC3D3BF20F31A25ACB34705D352B479_inline(L_47, L_48, NULL);
+		if (L_49)
+		{
+			goto IL_00e7;
+		}
+	}
+	{
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_50 = V_9;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_51 = V_8;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_52;
+		L_52 = Vector3_op_Subtraction_mE42023FF80067CB44A1D4A27EB7CF2B24CABB828_inline(L_50, L_51, NULL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_53 = V_7;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_54 = V_10;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_55;
+		L_55 = Vector3_op_Subtraction_mE42023FF80067CB44A1D4A27EB7CF2B24CABB828_inline(L_53, L_54, NULL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_56;
+		L_56 = Vector3_Max_m9B6D8FEE7F4CE32C0AAB682606FFBA59E1F37C74_inline(L_52, L_55, NULL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_57;
+		L_57 = Vector3_get_zero_m0C1249C3F25B1C70EAD3CC8B31259975A457AE39_inline(NULL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_58;
+		L_58 = Vector3_Max_m9B6D8FEE7F4CE32C0AAB682606FFBA59E1F37C74_inline(L_56, L_57, NULL);
+		float L_59;
+		L_59 = Vector3_SqrMagnitude_m5ED73273031577902F1BED4CA9C5A0E786A680D1_inline(L_58, NULL);
+		float L_60 = ___2_maxSqDistance;
+		if ((((float)L_59) > ((float)L_60)))
+		{
+			goto IL_0104;
+		}
+	}
+
+IL_00e7:
+	{
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_61 = ___0_polygonA;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_62 = ___1_polygonB;
 		il2cpp_codegen_runtime_class_init_inline(GeometryUtils_t7C09EB1813B4919671735BBDC45E031A6F8D1B98_il2cpp_TypeInfo_var);
-		GeometryUtils_ClosestPolygonApproach_mD0EB2883F064CC7A73484A610EA9BCB9D38FE38A(L_0, L_1, (&V_0), (&V_1), (0.0f), NULL);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_2 = V_1;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_3 = V_0;
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_4;
-		L_4 = Vector3_op_Subtraction_mE42023FF80067CB44A1D4A27EB7CF2B24CABB828_inline(L_2, L_3, NULL);
-		float L_5;
-		L_5 = Vector3_SqrMagnitude_m5ED73273031577902F1BED4CA9C5A0E786A680D1_inline(L_4, NULL);
-		float L_6 = ___2_maxSqDistance;
-		if ((((float)L_5) <= ((float)L_6)))
+		GeometryUtils_ClosestPolygonApproach_mD0EB2883F064CC7A73484A610EA9BCB9D38FE38A(L_61, L_62, (&V_0), (&V_1), (0.0f), NULL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_63 = V_1;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_64 = V_0;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_65;
+		L_65 = Vector3_op_Subtraction_mE42023FF80067CB44A1D4A27EB7CF2B24CABB828_inline(L_63, L_64, NULL);
+		float L_66;
+		L_66 = Vector3_SqrMagnitude_m5ED73273031577902F1BED4CA9C5A0E786A680D1_inline(L_65, NULL);
+		float L_67 = ___2_maxSqDistance;
+		if ((((float)L_66) <= ((float)L_67)))
 		{
-			goto IL_0030;
+			goto IL_0117;
 		}
 	}
+
+IL_0104:
 	{
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_7 = ___0_polygonA;
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_8 = ___1_polygonB;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_68 = ___0_polygonA;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_69 = ___1_polygonB;
 		il2cpp_codegen_runtime_class_init_inline(GeometryUtils_t7C09EB1813B4919671735BBDC45E031A6F8D1B98_il2cpp_TypeInfo_var);
-		bool L_9;
-		L_9 = GeometryUtils_PolygonInPolygon_m8311330C942DDFE0AD2F400CD74A66F7D223FEB5(L_7, L_8, NULL);
-		if (L_9)
+		bool L_70;
+		L_70 = GeometryUtils_PolygonInPolygon_m8311330C942DDFE0AD2F400CD74A66F7D223FEB5(L_68, L_69, NULL);
+		if (L_70)
 		{
-			goto IL_0030;
+			goto IL_0117;
 		}
 	}
 	{
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_10 = ___1_polygonB;
-		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_11 = ___0_polygonA;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_71 = ___1_polygonB;
+		List_1_t77B94703E05C519A9010DD0614F757F974E1CD8B* L_72 = ___0_polygonA;
 		il2cpp_codegen_runtime_class_init_inline(GeometryUtils_t7C09EB1813B4919671735BBDC45E031A6F8D1B98_il2cpp_TypeInfo_var);
-		bool L_12;
-		L_12 = GeometryUtils_PolygonInPolygon_m8311330C942DDFE0AD2F400CD74A66F7D223FEB5(L_10, L_11, NULL);
-		return L_12;
+		bool L_73;
+		L_73 = GeometryUtils_PolygonInPolygon_m8311330C942DDFE0AD2F400CD74A66F7D223FEB5(L_71, L_72, NULL);
+		return L_73;
 	}
 
-IL_0030:
+IL_0117:
 	{
 		return (bool)1;
 	}
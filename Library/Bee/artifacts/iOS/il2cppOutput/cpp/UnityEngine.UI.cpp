@@ -632,6 +632,7 @@ IL2CPP_EXTERN_C const RuntimeMethod* List_1__ctor_mE4F63B5B19EE65AC5D95239C70651
 IL2CPP_EXTERN_C const RuntimeMethod* List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_RuntimeMethod_var;
 IL2CPP_EXTERN_C const RuntimeMethod* List_1_get_Count_m39D4FCF97165F6499B8713930212C2083D4A098E_RuntimeMethod_var;
 IL2CPP_EXTERN_C const RuntimeMethod* List_1_get_Count_m5DE8EAB445663C9CE7E7BE0BA12C04E729482E6B_RuntimeMethod_var;
+IL2CPP_EXTERN_C const RuntimeMethod* List_1_get_Count_m79FB8A308070AEA69B25CD973D673A16B64D2F1A_RuntimeMethod_var;
 IL2CPP_EXTERN_C const RuntimeMethod* List_1_get_Count_m941E64469BB069E2B10382403A54FFFBEC81E1C2_RuntimeMethod_var;
 IL2CPP_EXTERN_C const RuntimeMethod* List_1_get_Count_m9CF4A6657F7D5E95A4A105F7E18047A70F55B82C_RuntimeMethod_var;
 IL2CPP_EXTERN_C const RuntimeMethod* List_1_get_Count_mA6321CE6CE41BA97E45D4EE105E170BE0C765998_RuntimeMethod_var;
@@ -3058,6 +3059,10 @@ inline int32_t IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_
 {
 	return ((  int32_t (*) (IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A*, const RuntimeMethod*))IndexedSet_1_get_Count_m864EB4B33F44B83EA661C84F488C6A4D50E57A77_gshared_inline)(__this, method);
 }
+inline int32_t List_1_get_Count_m79FB8A308070AEA69B25CD973D673A16B64D2F1A_inline (List_1_t02DF1539DF01B1631C7DD0DE0AD7ACE8839CB2D1* __this, const RuntimeMethod* method)
+{
+	return ((  int32_t (*) (List_1_t02DF1539DF01B1631C7DD0DE0AD7ACE8839CB2D1*, const RuntimeMethod*))List_1_get_Count_m4407E4C389F22B8CEC282C15D56516658746C383_gshared_inline)(__this, method);
+}
 inline RuntimeObject* IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6 (IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* __this, int32_t ___0_index, const RuntimeMethod* method)
 {
 	return ((  RuntimeObject* (*) (IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A*, int32_t, const RuntimeMethod*))IndexedSet_1_get_Item_mAED141786B952E5130673A5D9FD54EF3AD476FFA_gshared)(__this, ___0_index, method);
@@ -4925,6 +4930,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void CanvasUpdateRegistry_PerformUpdate_mA5CA
 		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&IndexedSet_1_Sort_mE424F41DEB7702250762CE881A4A789CBF7866B8_RuntimeMethod_var);
 		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
 		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
+		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&List_1_get_Count_m79FB8A308070AEA69B25CD973D673A16B64D2F1A_RuntimeMethod_var);
 		s_Il2CppMethodInitialized = true;
 	}
 	int32_t V_0 = 0;
@@ -4941,50 +4947,76 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void CanvasUpdateRegistry_PerformUpdate_mA5CA
 		CanvasUpdateRegistry_CleanInvalidItems_mFDBE5D212F6B9649B6EB619AA8860DB72F3AA80E(__this, NULL);
 		__this->___m_PerformingLayoutUpdate = (bool)1;
 		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_0 = __this->___m_LayoutRebuildQueue;
-		il2cpp_codegen_runtime_class_init_inline(CanvasUpdateRegistry_t7A4CC63D880F418DCDE83152B6FDB3259DF14DD1_il2cpp_TypeInfo_var);
-		Comparison_1_tC4095859478B8917FB775BFC44AB4189177C5BD1* L_1 = ((CanvasUpdateRegistry_t7A4CC63D880F418DCDE83152B6FDB3259DF14DD1_StaticFields*)il2cpp_codegen_static_fields_for(CanvasUpdateRegistry_t7A4CC63D880F418DCDE83152B6FDB3259DF14DD1_il2cpp_TypeInfo_var))->___s_SortLayoutFunction;
 		NullCheck(L_0);
-		IndexedSet_1_Sort_mE424F41DEB7702250762CE881A4A789CBF7866B8(L_0, L_1, IndexedSet_1_Sort_mE424F41DEB7702250762CE881A4A789CBF7866B8_RuntimeMethod_var);
+		List_1_t02DF1539DF01B1631C7DD0DE0AD7ACE8839CB2D1* L_1 = L_0->___m_List;
+		NullCheck(L_1);
+		int32_t L_2;
+		L_2 = List_1_get_Count_m79FB8A308070AEA69B25CD973D673A16B64D2F1A_inline(L_1, List_1_get_Count_m79FB8A308070AEA69B25CD973D673A16B64D2F1A_RuntimeMethod_var);
+		if ((((int32_t)L_2) < ((int32_t)2)))
+		{
+			goto IL_0036;
+		}
+	}
+	{
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_3 = __this->___m_LayoutRebuildQueue;
+		il2cpp_codegen_runtime_class_init_inline(CanvasUpdateRegistry_t7A4CC63D880F418DCDE83152B6FDB3259DF14DD1_il2cpp_TypeInfo_var);
+		Comparison_1_tC4095859478B8917FB775BFC44AB4189177C5BD1* L_4 = ((CanvasUpdateRegistry_t7A4CC63D880F418DCDE83152B6FDB3259DF14DD1_StaticFields*)il2cpp_codegen_static_fields_for(CanvasUpdateRegistry_t7A4CC63D880F418DCDE83152B6FDB3259DF14DD1_il2cpp_TypeInfo_var))->___s_SortLayoutFunction;
+		NullCheck(L_3);
+		IndexedSet_1_Sort_mE424F41DEB7702250762CE881A4A789CBF7866B8(L_3, L_4, IndexedSet_1_Sort_mE424F41DEB7702250762CE881A4A789CBF7866B8_RuntimeMethod_var);
+	}
+
+IL_0036:
+	{
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_5 = __this->___m_LayoutRebuildQueue;
+		NullCheck(L_5);
+		int32_t L_6;
+		L_6 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_5, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
+		if (!L_6)
+		{
+			goto IL_00bb;
+		}
+	}
+	{
 		V_0 = 0;
-		goto IL_006d;
+		goto IL_0090;
 	}
 
-IL_0027:
+IL_004a:
 	{
 		V_1 = 0;
-		goto IL_005b;
+		goto IL_007e;
 	}
 
-IL_002b:
+IL_004e:
 	{
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_2 = __this->___m_LayoutRebuildQueue;
-		int32_t L_3 = V_1;
-		NullCheck(L_2);
-		RuntimeObject* L_4;
-		L_4 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_2, L_3, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
-		V_2 = L_4;
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_7 = __this->___m_LayoutRebuildQueue;
+		int32_t L_8 = V_1;
+		NullCheck(L_7);
+		RuntimeObject* L_9;
+		L_9 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_7, L_8, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
+		V_2 = L_9;
 	}
 	try
 	{
 		{
-			RuntimeObject* L_5 = V_2;
-			bool L_6;
-			L_6 = CanvasUpdateRegistry_ObjectValidForUpdate_mFF8ACAA818FA7F73C5A6447C8E1E61631690660A(__this, L_5, NULL);
-			if (!L_6)
+			RuntimeObject* L_10 = V_2;
+			bool L_11;
+			L_11 = CanvasUpdateRegistry_ObjectValidForUpdate_mFF8ACAA818FA7F73C5A6447C8E1E61631690660A(__this, L_10, NULL);
+			if (!L_11)
 			{
-				goto IL_0048_1;
+				goto IL_006b_1;
 			}
 		}
 		{
-			RuntimeObject* L_7 = V_2;
-			int32_t L_8 = V_0;
-			NullCheck(L_7);
-			InterfaceActionInvoker1< int32_t >::Invoke(0, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_7, L_8);
+			RuntimeObject* L_12 = V_2;
+			int32_t L_13 = V_0;
+			NullCheck(L_12);
+			InterfaceActionInvoker1< int32_t >::Invoke(0, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_12, L_13);
 		}
 
-IL_0048_1:
+IL_006b_1:
 		{
-			goto IL_0057;
+			goto IL_007a;
 		}
 	}
 	catch(Il2CppExceptionWrapper& e)
@@ -4992,137 +5024,149 @@ IL_0048_1:
 		if(il2cpp_codegen_class_is_assignable_from (((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&Exception_t_il2cpp_TypeInfo_var)), il2cpp_codegen_object_class(e.ex)))
 		{
 			IL2CPP_PUSH_ACTIVE_EXCEPTION(e.ex);
-			goto CATCH_004a;
+			goto CATCH_006d;
 		}
 		throw e;
 	}
 
-CATCH_004a:
+CATCH_006d:
 	{
-		Exception_t* L_9 = ((Exception_t*)IL2CPP_GET_ACTIVE_EXCEPTION(Exception_t*));;
-		RuntimeObject* L_10 = V_2;
-		NullCheck(L_10);
-		Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* L_11;
-		L_11 = InterfaceFuncInvoker0< Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* >::Invoke(1, ((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var)), L_10);
+		Exception_t* L_14 = ((Exception_t*)IL2CPP_GET_ACTIVE_EXCEPTION(Exception_t*));;
+		RuntimeObject* L_15 = V_2;
+		NullCheck(L_15);
+		Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* L_16;
+		L_16 = InterfaceFuncInvoker0< Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* >::Invoke(1, ((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var)), L_15);
 		il2cpp_codegen_runtime_class_init_inline(((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&Debug_t8394C7EEAECA3689C2C9B9DE9C7166D73596276F_il2cpp_TypeInfo_var)));
-		Debug_LogException_mD4CF3A9C64D8D4BA0570D529E705D134A9A5E498(L_9, L_11, NULL);
+		Debug_LogException_mD4CF3A9C64D8D4BA0570D529E705D134A9A5E498(L_14, L_16, NULL);
 		IL2CPP_POP_ACTIVE_EXCEPTION(Exception_t*);
-		goto IL_0057;
+		goto IL_007a;
 	}
 
-IL_0057:
+IL_007a:
 	{
-		int32_t L_12 = V_1;
-		V_1 = ((int32_t)il2cpp_codegen_add(L_12, 1));
+		int32_t L_17 = V_1;
+		V_1 = ((int32_t)il2cpp_codegen_add(L_17, 1));
 	}
 
-IL_005b:
+IL_007e:
 	{
-		int32_t L_13 = V_1;
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_14 = __this->___m_LayoutRebuildQueue;
-		NullCheck(L_14);
-		int32_t L_15;
-		L_15 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_14, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
-		if ((((int32_t)L_13) < ((int32_t)L_15)))
+		int32_t L_18 = V_1;
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_19 = __this->___m_LayoutRebuildQueue;
+		NullCheck(L_19);
+		int32_t L_20;
+		L_20 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_19, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
+		if ((((int32_t)L_18) < ((int32_t)L_20)))
 		{
-			goto IL_002b;
+			goto IL_004e;
 		}
 	}
 	{
-		int32_t L_16 = V_0;
-		V_0 = ((int32_t)il2cpp_codegen_add(L_16, 1));
+		int32_t L_21 = V_0;
+		V_0 = ((int32_t)il2cpp_codegen_add(L_21, 1));
 	}
 
-IL_006d:
+IL_0090:
 	{
-		int32_t L_17 = V_0;
-		if ((((int32_t)L_17) <= ((int32_t)2)))
+		int32_t L_22 = V_0;
+		if ((((int32_t)L_22) <= ((int32_t)2)))
 		{
-			goto IL_0027;
+			goto IL_004a;
 		}
 	}
 	{
 		V_3 = 0;
-		goto IL_008a;
+		goto IL_00ad;
 	}
 
-IL_0075:
+IL_0098:
 	{
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_18 = __this->___m_LayoutRebuildQueue;
-		int32_t L_19 = V_3;
-		NullCheck(L_18);
-		RuntimeObject* L_20;
-		L_20 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_18, L_19, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
-		NullCheck(L_20);
-		InterfaceActionInvoker0::Invoke(2, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_20);
-		int32_t L_21 = V_3;
-		V_3 = ((int32_t)il2cpp_codegen_add(L_21, 1));
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_23 = __this->___m_LayoutRebuildQueue;
+		int32_t L_24 = V_3;
+		NullCheck(L_23);
+		RuntimeObject* L_25;
+		L_25 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_23, L_24, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
+		NullCheck(L_25);
+		InterfaceActionInvoker0::Invoke(2, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_25);
+		int32_t L_26 = V_3;
+		V_3 = ((int32_t)il2cpp_codegen_add(L_26, 1));
 	}
 
-IL_008a:
+IL_00ad:
 	{
-		int32_t L_22 = V_3;
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_23 = __this->___m_LayoutRebuildQueue;
-		NullCheck(L_23);
-		int32_t L_24;
-		L_24 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_23, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
-		if ((((int32_t)L_22) < ((int32_t)L_24)))
+		int32_t L_27 = V_3;
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_28 = __this->___m_LayoutRebuildQueue;
+		NullCheck(L_28);
+		int32_t L_29;
+		L_29 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_28, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
+		if ((((int32_t)L_27) < ((int32_t)L_29)))
 		{
-			goto IL_0075;
+			goto IL_0098;
 		}
 	}
+
+IL_00bb:
 	{
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_25 = __this->___m_LayoutRebuildQueue;
-		NullCheck(L_25);
-		IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B(L_25, IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B_RuntimeMethod_var);
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_30 = __this->___m_LayoutRebuildQueue;
+		NullCheck(L_30);
+		IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B(L_30, IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B_RuntimeMethod_var);
 		__this->___m_PerformingLayoutUpdate = (bool)0;
 		UISystemProfilerApi_EndSample_mAFBCEDF8073F3FB0E1644482D909F108DBE11F3D(0, NULL);
 		UISystemProfilerApi_BeginSample_m6AF893A85204DA2129D9D3D75D8A6EDD329FA23E(1, NULL);
-		ClipperRegistry_t0623143AE0681BE34AEEC1571B60C632C6E4B633* L_26;
-		L_26 = ClipperRegistry_get_instance_m709E4407231F3C616FCE693389AE2BC0121FCE40(NULL);
-		NullCheck(L_26);
-		ClipperRegistry_Cull_mE2BBF0B75900B6780EDE22699476542FC5B62730(L_26, NULL);
+		ClipperRegistry_t0623143AE0681BE34AEEC1571B60C632C6E4B633* L_31;
+		L_31 = ClipperRegistry_get_instance_m709E4407231F3C616FCE693389AE2BC0121FCE40(NULL);
+		NullCheck(L_31);
+		ClipperRegistry_Cull_mE2BBF0B75900B6780EDE22699476542FC5B62730(L_31, NULL);
 		__this->___m_PerformingGraphicUpdate = (bool)1;
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_32 = __this->___m_GraphicRebuildQueue;
+		NullCheck(L_32);
+		int32_t L_33;
+		L_33 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_32, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
+		if (!L_33)
+		{
+			goto IL_018e;
+		}
+	}
+	{
 		V_4 = 3;
-		goto IL_012a;
+		goto IL_015d;
 	}
 
-IL_00cc:
+IL_00ff:
 	{
 		V_5 = 0;
-		goto IL_0115;
+		goto IL_0148;
 	}
 
-IL_00d1:
+IL_0104:
 	{
 	}
 	try
 	{
 		{
-			IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_27 = __this->___m_GraphicRebuildQueue;
-			int32_t L_28 = V_5;
-			NullCheck(L_27);
-			RuntimeObject* L_29;
-			L_29 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_27, L_28, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
-			V_6 = L_29;
-			RuntimeObject* L_30 = V_6;
-			bool L_31;
-			L_31 = CanvasUpdateRegistry_ObjectValidForUpdate_mFF8ACAA818FA7F73C5A6447C8E1E61631690660A(__this, L_30, NULL);
-			if (!L_31)
+			IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_34 = __this->___m_GraphicRebuildQueue;
+			int32_t L_35 = V_5;
+			NullCheck(L_34);
+			RuntimeObject* L_36;
+			L_36 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_34, L_35, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
+			V_6 = L_36;
+			RuntimeObject* L_37 = V_6;
+			bool L_38;
+			L_38 = CanvasUpdateRegistry_ObjectValidForUpdate_mFF8ACAA818FA7F73C5A6447C8E1E61631690660A(__this, L_37, NULL);
+			if (!L_38)
 			{
-				goto IL_00f4_1;
+				goto IL_0127_1;
 			}
 		}
 		{
-			RuntimeObject* L_32 = V_6;
-			int32_t L_33 = V_4;
-			NullCheck(L_32);
-			InterfaceActionInvoker1< int32_t >::Invoke(0, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_32, L_33);
+			RuntimeObject* L_39 = V_6;
+			int32_t L_40 = V_4;
+			NullCheck(L_39);
+			InterfaceActionInvoker1< int32_t >::Invoke(0, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_39, L_40);
 		}
 
-IL_00f4_1:
+IL_0127_1:
 		{
-			goto IL_010f;
+			goto IL_0142;
 		}
 	}
 	catch(Il2CppExceptionWrapper& e)
@@ -5130,93 +5174,95 @@ IL_00f4_1:
 		if(il2cpp_codegen_class_is_assignable_from (((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&Exception_t_il2cpp_TypeInfo_var)), il2cpp_codegen_object_class(e.ex)))
 		{
 			IL2CPP_PUSH_ACTIVE_EXCEPTION(e.ex);
-			goto CATCH_00f6;
+			goto CATCH_0129;
 		}
 		throw e;
 	}
 
-CATCH_00f6:
+CATCH_0129:
 	{
-		Exception_t* L_34 = ((Exception_t*)IL2CPP_GET_ACTIVE_EXCEPTION(Exception_t*));;
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_35 = __this->___m_GraphicRebuildQueue;
-		int32_t L_36 = V_5;
-		NullCheck(L_35);
-		RuntimeObject* L_37;
-		L_37 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_35, L_36, ((RuntimeMethod*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var)));
-		NullCheck(L_37);
-		Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* L_38;
-		L_38 = InterfaceFuncInvoker0< Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* >::Invoke(1, ((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var)), L_37);
+		Exception_t* L_41 = ((Exception_t*)IL2CPP_GET_ACTIVE_EXCEPTION(Exception_t*));;
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_42 = __this->___m_GraphicRebuildQueue;
+		int32_t L_43 = V_5;
+		NullCheck(L_42);
+		RuntimeObject* L_44;
+		L_44 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_42, L_43, ((RuntimeMethod*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var)));
+		NullCheck(L_44);
+		Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* L_45;
+		L_45 = InterfaceFuncInvoker0< Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* >::Invoke(1, ((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var)), L_44);
 		il2cpp_codegen_runtime_class_init_inline(((RuntimeClass*)il2cpp_codegen_initialize_runtime_metadata_inline((uintptr_t*)&Debug_t8394C7EEAECA3689C2C9B9DE9C7166D73596276F_il2cpp_TypeInfo_var)));
-		Debug_LogException_mD4CF3A9C64D8D4BA0570D529E705D134A9A5E498(L_34, L_38, NULL);
+		Debug_LogException_mD4CF3A9C64D8D4BA0570D529E705D134A9A5E498(L_41, L_45, NULL);
 		IL2CPP_POP_ACTIVE_EXCEPTION(Exception_t*);
-		goto IL_010f;
+		goto IL_0142;
 	}
 
-IL_010f:
+IL_0142:
 	{
-		int32_t L_39 = V_5;
-		V_5 = ((int32_t)il2cpp_codegen_add(L_39, 1));
+		int32_t L_46 = V_5;
+		V_5 = ((int32_t)il2cpp_codegen_add(L_46, 1));
 	}
 
-IL_0115:
+IL_0148:
 	{
-		int32_t L_40 = V_5;
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_41 = __this->___m_GraphicRebuildQueue;
-		NullCheck(L_41);
-		int32_t L_42;
-		L_42 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_41, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
-		if ((((int32_t)L_40) < ((int32_t)L_42)))
+		int32_t L_47 = V_5;
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_48 = __this->___m_GraphicRebuildQueue;
+		NullCheck(L_48);
+		int32_t L_49;
+		L_49 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_48, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
+		if ((((int32_t)L_47) < ((int32_t)L_49)))
 		{
-			goto IL_00d1;
+			goto IL_0104;
 		}
 	}
 	{
-		int32_t L_43 = V_4;
-		V_4 = ((int32_t)il2cpp_codegen_add(L_43, 1));
+		int32_t L_50 = V_4;
+		V_4 = ((int32_t)il2cpp_codegen_add(L_50, 1));
 	}
 
-IL_012a:
+IL_015d:
 	{
-		int32_t L_44 = V_4;
-		if ((((int32_t)L_44) < ((int32_t)5)))
+		int32_t L_51 = V_4;
+		if ((((int32_t)L_51) < ((int32_t)5)))
 		{
-			goto IL_00cc;
+			goto IL_00ff;
 		}
 	}
 	{
 		V_7 = 0;
-		goto IL_014c;
+		goto IL_017f;
 	}
 
-IL_0134:
+IL_0167:
 	{
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_45 = __this->___m_GraphicRebuildQueue;
-		int32_t L_46 = V_7;
-		NullCheck(L_45);
-		RuntimeObject* L_47;
-		L_47 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_45, L_46, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
-		NullCheck(L_47);
-		InterfaceActionInvoker0::Invoke(3, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_47);
-		int32_t L_48 = V_7;
-		V_7 = ((int32_t)il2cpp_codegen_add(L_48, 1));
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_52 = __this->___m_GraphicRebuildQueue;
+		int32_t L_53 = V_7;
+		NullCheck(L_52);
+		RuntimeObject* L_54;
+		L_54 = IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6(L_52, L_53, IndexedSet_1_get_Item_mC699B35F2F1F5341256BC96E4D4FAB32D52D51E6_RuntimeMethod_var);
+		NullCheck(L_54);
+		InterfaceActionInvoker0::Invoke(3, ICanvasElement_t7F0ABB1280486B82E3267F9C26130FD4AAACAE91_il2cpp_TypeInfo_var, L_54);
+		int32_t L_55 = V_7;
+		V_7 = ((int32_t)il2cpp_codegen_add(L_55, 1));
 	}
 
-IL_014c:
+IL_017f:
 	{
-		int32_t L_49 = V_7;
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_50 = __this->___m_GraphicRebuildQueue;
-		NullCheck(L_50);
-		int32_t L_51;
-		L_51 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_50, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
-		if ((((int32_t)L_49) < ((int32_t)L_51)))
+		int32_t L_56 = V_7;
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_57 = __this->___m_GraphicRebuildQueue;
+		NullCheck(L_57);
+		int32_t L_58;
+		L_58 = IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_inline(L_57, IndexedSet_1_get_Count_mA96F9572D39F05307045E8F74CA85BF54F0B202A_RuntimeMethod_var);
+		if ((((int32_t)L_56) < ((int32_t)L_58)))
 		{
-			goto IL_0134;
+			goto IL_0167;
 		}
 	}
+
+IL_018e:
 	{
-		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_52 = __this->___m_GraphicRebuildQueue;
-		NullCheck(L_52);
-		IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B(L_52, IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B_RuntimeMethod_var);
+		IndexedSet_1_t3B313644ADE41119437F88B40BFA37D89EAA773A* L_59 = __this->___m_GraphicRebuildQueue;
+		NullCheck(L_59);
+		IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B(L_59, IndexedSet_1_Clear_m0EBD09FC0B98B7F1703C55E069630DE72695F13B_RuntimeMethod_var);
 		__this->___m_PerformingGraphicUpdate = (bool)0;
 		UISystemProfilerApi_EndSample_mAFBCEDF8073F3FB0E1644482D909F108DBE11F3D(1, NULL);
 		return;
@@ -16678,6 +16724,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void GraphicRaycaster_Raycast_m06B8EF9AC17F7B
 	int32_t V_1 = 0;
 	Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* V_2 = NULL;
 	int32_t V_3 = 0;
+	RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* V_4 = NULL;
 	Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* G_B13_0 = NULL;
 	List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* G_B13_1 = NULL;
 	Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* G_B12_0 = NULL;
@@ -16737,6 +16784,7 @@ IL_000b:
 		NullCheck(L_12);
 		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_13;
 		L_13 = Graphic_get_rectTransform_mF4752E8934267D630810E84CE02CDFB81EB1FD6D(L_12, NULL);
+		V_4 = L_13;
 		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_14 = ___2_pointerPosition;
 		Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* L_15 = ___1_eventCamera;
 		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_16 = V_2;
@@ -16763,22 +16811,19 @@ IL_000b:
 	}
 	{
 		Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* L_21 = ___1_eventCamera;
-		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_22 = V_2;
+		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_22 = V_4;
 		NullCheck(L_22);
-		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_23;
-		L_23 = Graphic_get_rectTransform_mF4752E8934267D630810E84CE02CDFB81EB1FD6D(L_22, NULL);
-		NullCheck(L_23);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_24;
-		L_24 = Transform_get_position_m69CD5FA214FDAE7BB701552943674846C220FDE1(L_23, NULL);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_23;
+		L_23 = Transform_get_position_m69CD5FA214FDAE7BB701552943674846C220FDE1(L_22, NULL);
 		NullCheck(L_21);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_25;
-		L_25 = Camera_WorldToScreenPoint_m26B4C8945C3B5731F1CC5944CFD96BF17126BAA3(L_21, L_24, NULL);
-		float L_26 = L_25.___z;
-		Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* L_27 = ___1_eventCamera;
-		NullCheck(L_27);
-		float L_28;
-		L_28 = Camera_get_farClipPlane_m1D7128B85B5DB866F75FBE8CEBA48335716B67BD(L_27, NULL);
-		if ((((float)L_26) > ((float)L_28)))
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_24;
+		L_24 = Camera_WorldToScreenPoint_m26B4C8945C3B5731F1CC5944CFD96BF17126BAA3(L_21, L_23, NULL);
+		float L_25 = L_24.___z;
+		Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* L_26 = ___1_eventCamera;
+		NullCheck(L_26);
+		float L_27;
+		L_27 = Camera_get_farClipPlane_m1D7128B85B5DB866F75FBE8CEBA48335716B67BD(L_26, NULL);
+		if ((((float)L_25) > ((float)L_27)))
 		{
 			goto IL_0082;
 		}
@@ -16786,64 +16831,64 @@ IL_000b:
 
 IL_006d:
 	{
-		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_29 = V_2;
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_30 = ___2_pointerPosition;
-		Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* L_31 = ___1_eventCamera;
-		NullCheck(L_29);
-		bool L_32;
-		L_32 = VirtualFuncInvoker2< bool, Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7, Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* >::Invoke(46, L_29, L_30, L_31);
-		if (!L_32)
+		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_28 = V_2;
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_29 = ___2_pointerPosition;
+		Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* L_30 = ___1_eventCamera;
+		NullCheck(L_28);
+		bool L_31;
+		L_31 = VirtualFuncInvoker2< bool, Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7, Camera_tA92CC927D7439999BC82DBEDC0AA45B470F9E184* >::Invoke(46, L_28, L_29, L_30);
+		if (!L_31)
 		{
 			goto IL_0082;
 		}
 	}
 	{
 		il2cpp_codegen_runtime_class_init_inline(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var);
-		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_33 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
-		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_34 = V_2;
-		NullCheck(L_33);
-		List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_inline(L_33, L_34, List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_RuntimeMethod_var);
+		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_32 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
+		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_33 = V_2;
+		NullCheck(L_32);
+		List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_inline(L_32, L_33, List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_RuntimeMethod_var);
 	}
 
 IL_0082:
 	{
-		int32_t L_35 = V_1;
-		V_1 = ((int32_t)il2cpp_codegen_add(L_35, 1));
+		int32_t L_34 = V_1;
+		V_1 = ((int32_t)il2cpp_codegen_add(L_34, 1));
 	}
 
 IL_0086:
 	{
-		int32_t L_36 = V_1;
-		int32_t L_37 = V_0;
-		if ((((int32_t)L_36) < ((int32_t)L_37)))
+		int32_t L_35 = V_1;
+		int32_t L_36 = V_0;
+		if ((((int32_t)L_35) < ((int32_t)L_36)))
 		{
 			goto IL_000b;
 		}
 	}
 	{
 		il2cpp_codegen_runtime_class_init_inline(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var);
-		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_38 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
+		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_37 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
 		il2cpp_codegen_runtime_class_init_inline(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var);
-		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_39 = ((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9__27_0;
-		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_40 = L_39;
-		if (L_40)
+		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_38 = ((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9__27_0;
+		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_39 = L_38;
+		if (L_39)
 		{
-			G_B13_0 = L_40;
-			G_B13_1 = L_38;
+			G_B13_0 = L_39;
+			G_B13_1 = L_37;
 			goto IL_00ae;
 		}
-		G_B12_0 = L_40;
-		G_B12_1 = L_38;
+		G_B12_0 = L_39;
+		G_B12_1 = L_37;
 	}
 	{
 		il2cpp_codegen_runtime_class_init_inline(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var);
-		U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC* L_41 = ((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9;
-		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_42 = (Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8*)il2cpp_codegen_object_new(Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8_il2cpp_TypeInfo_var);
-		Comparison_1__ctor_mD11216CBE74D2E2B53367EFFFC349A9491F4700E(L_42, L_41, (intptr_t)((void*)U3CU3Ec_U3CRaycastU3Eb__27_0_m81E2CE6D45AE93300AF014EA75EF4A4B2E4C059A_RuntimeMethod_var), NULL);
-		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_43 = L_42;
-		((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9__27_0 = L_43;
-		Il2CppCodeGenWriteBarrier((void**)(&((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9__27_0), (void*)L_43);
-		G_B13_0 = L_43;
+		U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC* L_40 = ((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9;
+		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_41 = (Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8*)il2cpp_codegen_object_new(Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8_il2cpp_TypeInfo_var);
+		Comparison_1__ctor_mD11216CBE74D2E2B53367EFFFC349A9491F4700E(L_41, L_40, (intptr_t)((void*)U3CU3Ec_U3CRaycastU3Eb__27_0_m81E2CE6D45AE93300AF014EA75EF4A4B2E4C059A_RuntimeMethod_var), NULL);
+		Comparison_1_t236C83451572505C1D483C9DFB0550F3470A17B8* L_42 = L_41;
+		((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9__27_0 = L_42;
+		Il2CppCodeGenWriteBarrier((void**)(&((U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_StaticFields*)il2cpp_codegen_static_fields_for(U3CU3Ec_tFE23038B63E5E9EDD95FF07844C136230AED9FFC_il2cpp_TypeInfo_var))->___U3CU3E9__27_0), (void*)L_42);
+		G_B13_0 = L_42;
 		G_B13_1 = G_B12_1;
 	}
 
@@ -16852,44 +16897,44 @@ IL_00ae:
 		NullCheck(G_B13_1);
 		List_1_Sort_mBC2289D3F4C480D2369DE56E27FFF2D60F6065BA(G_B13_1, G_B13_0, List_1_Sort_mBC2289D3F4C480D2369DE56E27FFF2D60F6065BA_RuntimeMethod_var);
 		il2cpp_codegen_runtime_class_init_inline(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var);
-		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_44 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
-		NullCheck(L_44);
-		int32_t L_45;
-		L_45 = List_1_get_Count_m941E64469BB069E2B10382403A54FFFBEC81E1C2_inline(L_44, List_1_get_Count_m941E64469BB069E2B10382403A54FFFBEC81E1C2_RuntimeMethod_var);
-		V_0 = L_45;
+		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_43 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
+		NullCheck(L_43);
+		int32_t L_44;
+		L_44 = List_1_get_Count_m941E64469BB069E2B10382403A54FFFBEC81E1C2_inline(L_43, List_1_get_Count_m941E64469BB069E2B10382403A54FFFBEC81E1C2_RuntimeMethod_var);
+		V_0 = L_44;
 		V_3 = 0;
 		goto IL_00d8;
 	}
 
 IL_00c2:
 	{
-		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_46 = ___4_results;
+		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_45 = ___4_results;
 		il2cpp_codegen_runtime_class_init_inline(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var);
-		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_47 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
-		int32_t L_48 = V_3;
-		NullCheck(L_47);
-		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_49;
-		L_49 = List_1_get_Item_mB8A52ADCAAD63404D867CBC8F628FFC61FE0E079(L_47, L_48, List_1_get_Item_mB8A52ADCAAD63404D867CBC8F628FFC61FE0E079_RuntimeMethod_var);
+		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_46 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
+		int32_t L_47 = V_3;
 		NullCheck(L_46);
-		List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_inline(L_46, L_49, List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_RuntimeMethod_var);
-		int32_t L_50 = V_3;
-		V_3 = ((int32_t)il2cpp_codegen_add(L_50, 1));
+		Graphic_tCBFCA4585A19E2B75465AECFEAC43F4016BF7931* L_48;
+		L_48 = List_1_get_Item_mB8A52ADCAAD63404D867CBC8F628FFC61FE0E079(L_46, L_47, List_1_get_Item_mB8A52ADCAAD63404D867CBC8F628FFC61FE0E079_RuntimeMethod_var);
+		NullCheck(L_45);
+		List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_inline(L_45, L_48, List_1_Add_m42E10FA8D8A3A37D4C1952CBB751D4B5A32571AF_RuntimeMethod_var);
+		int32_t L_49 = V_3;
+		V_3 = ((int32_t)il2cpp_codegen_add(L_49, 1));
 	}
 
 IL_00d8:
 	{
-		int32_t L_51 = V_3;
-		int32_t L_52 = V_0;
-		if ((((int32_t)L_51) < ((int32_t)L_52)))
+		int32_t L_50 = V_3;
+		int32_t L_51 = V_0;
+		if ((((int32_t)L_50) < ((int32_t)L_51)))
 		{
 			goto IL_00c2;
 		}
 	}
 	{
 		il2cpp_codegen_runtime_class_init_inline(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var);
-		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_53 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
-		NullCheck(L_53);
-		List_1_Clear_mB78BC675607A46A8FD22C16A4BE1E9175FE382D0_inline(L_53, List_1_Clear_mB78BC675607A46A8FD22C16A4BE1E9175FE382D0_RuntimeMethod_var);
+		List_1_tF6D13D87DD02D4EF3ECD7763371397BD6D1A2C0F* L_52 = ((GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_StaticFields*)il2cpp_codegen_static_fields_for(GraphicRaycaster_t16FC39434AE5B47D3C2993134CDCF7F4AE6A6D7B_il2cpp_TypeInfo_var))->___s_SortedGraphics;
+		NullCheck(L_52);
+		List_1_Clear_mB78BC675607A46A8FD22C16A4BE1E9175FE382D0_inline(L_52, List_1_Clear_mB78BC675607A46A8FD22C16A4BE1E9175FE382D0_RuntimeMethod_var);
 		return;
 	}
 }
@@ -8837,6 +8837,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void VisualTreeDataBindingsUpdater_Update_m67
 	Enumerator_t72556E98D7DDBE118A973D782D523D15A96461C8 V_36;
 	memset((&V_36), 0, sizeof(V_36));
 	RuntimeObject* V_37 = NULL;
+	DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* V_38 = NULL;
 	int32_t G_B9_0 = 0;
 	int32_t G_B19_0 = 0;
 	int32_t G_B23_0 = 0;
@@ -8849,6 +8850,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void VisualTreeDataBindingsUpdater_Update_m67
 		List_1_t6115BBE78FE9310B180A2027321DF46F2A06AC95* L_1 = __this->___m_BoundsElement;
 		DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_2;
 		L_2 = VisualTreeDataBindingsUpdater_get_bindingManager_m9CB6AA776854821378E0C9F8E0F76F49E35A7F68(__this, NULL);
+		V_38 = L_2;
 		NullCheck(L_2);
 		RuntimeObject* L_3;
 		L_3 = DataBindingManager_GetBoundElements_mC5A7E42826191E37D8EA4B3AD496DC2713EE6240(L_2, NULL);
@@ -8881,8 +8883,7 @@ IL_004c_1:
 				VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_6;
 				L_6 = Enumerator_get_Current_mB7757CAB14504096954228BA7CF5F646853128D4_inline((&V_0), Enumerator_get_Current_mB7757CAB14504096954228BA7CF5F646853128D4_RuntimeMethod_var);
 				V_1 = L_6;
-				DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_7;
-				L_7 = VisualTreeDataBindingsUpdater_get_bindingManager_m9CB6AA776854821378E0C9F8E0F76F49E35A7F68(__this, NULL);
+				DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_7 = V_38;
 				VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_8 = V_1;
 				NullCheck(L_7);
 				List_1_t660C0DEB5CCE3DB654363B2C90CC563508E5B65B* L_9;
@@ -8920,8 +8921,7 @@ FINALLY_0218_1:
 				try
 				{
 					{
-						DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_15;
-						L_15 = VisualTreeDataBindingsUpdater_get_bindingManager_m9CB6AA776854821378E0C9F8E0F76F49E35A7F68(__this, NULL);
+						DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_15 = V_38;
 						VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_16 = V_1;
 						BindingData_t63DF4F2F4FA1BE1BD6130C2DDAE1888DCD76381A* L_17 = V_4;
 						NullCheck(L_15);
@@ -9098,8 +9098,7 @@ IL_0185_2:
 						}
 					}
 					{
-						DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_64;
-						L_64 = VisualTreeDataBindingsUpdater_get_bindingManager_m9CB6AA776854821378E0C9F8E0F76F49E35A7F68(__this, NULL);
+						DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_64 = V_38;
 						RuntimeObject* L_65 = V_6;
 						NullCheck(L_64);
 						List_1_tBC807FE544A0075E15B71999EE285F161BEA7076* L_66;
@@ -9478,8 +9477,7 @@ IL_0367_1:
 				VersionInfo_tD8EF94E6EB7FCB9167CE193F9FFAAB6DE0518DE8 L_126;
 				L_126 = Enumerator_get_Current_mA6FE2D4651BC2A29424F9112580D36BC16C36B6D_inline((&V_34), Enumerator_get_Current_mA6FE2D4651BC2A29424F9112580D36BC16C36B6D_RuntimeMethod_var);
 				V_35 = L_126;
-				DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_127;
-				L_127 = VisualTreeDataBindingsUpdater_get_bindingManager_m9CB6AA776854821378E0C9F8E0F76F49E35A7F68(__this, NULL);
+				DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_127 = V_38;
 				VersionInfo_tD8EF94E6EB7FCB9167CE193F9FFAAB6DE0518DE8 L_128 = V_35;
 				RuntimeObject* L_129 = L_128.___source;
 				VersionInfo_tD8EF94E6EB7FCB9167CE193F9FFAAB6DE0518DE8 L_130 = V_35;
@@ -9538,8 +9536,7 @@ IL_03c3_1:
 				RuntimeObject* L_136;
 				L_136 = Enumerator_get_Current_m139A176CD271A0532D75BE08DA7831C8C45CE28F_inline((&V_36), Enumerator_get_Current_m139A176CD271A0532D75BE08DA7831C8C45CE28F_RuntimeMethod_var);
 				V_37 = L_136;
-				DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_137;
-				L_137 = VisualTreeDataBindingsUpdater_get_bindingManager_m9CB6AA776854821378E0C9F8E0F76F49E35A7F68(__this, NULL);
+				DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_137 = V_38;
 				RuntimeObject* L_138 = V_37;
 				NullCheck(L_137);
 				DataBindingManager_ClearChangesFromSource_m4ED4D56F353EC92CCC6B6A4690F98F505EA8939D(L_137, L_138, NULL);
@@ -9584,8 +9581,7 @@ IL_03f6:
 		HashSet_1_tBF3C95D0A910445C05339BA7B9774E8A56509E70* L_145 = __this->___m_DirtyBindings;
 		NullCheck(L_145);
 		HashSet_1_Clear_mDBC3D5061E943E40DE91F63A44ABBACC8F000CFC(L_145, HashSet_1_Clear_mDBC3D5061E943E40DE91F63A44ABBACC8F000CFC_RuntimeMethod_var);
-		DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_146;
-		L_146 = VisualTreeDataBindingsUpdater_get_bindingManager_m9CB6AA776854821378E0C9F8E0F76F49E35A7F68(__this, NULL);
+		DataBindingManager_tE7B33E64EBBDCAB0A89B6A8421529F9BA0D066E1* L_146 = V_38;
 		NullCheck(L_146);
 		DataBindingManager_ClearSourceCache_m40F06EA3BD92E507FADF674E01DFFBF9332E7932(L_146, NULL);
 		return;
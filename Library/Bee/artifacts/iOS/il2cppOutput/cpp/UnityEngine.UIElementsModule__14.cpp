@@ -9697,6 +9697,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58
 	memset((&V_26), 0, sizeof(V_26));
 	ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C V_27;
 	memset((&V_27), 0, sizeof(V_27));
+	StylePropertyReader_tA960AF3A0C411045E92E04E997D7EB2EF1B7552A* V_28 = NULL;
+	StyleVariableContext_tF74F2787CE1F6BEBBFBFF0771CF493AC9E403527* V_29 = NULL;
 	Comparison_1_t1E2D8261CC6BDF2163403F266C5410F5D18FABE0* G_B2_0 = NULL;
 	List_1_tA1D3D4FCA4CFF8E02845F48D747A4C704D4C9CAE* G_B2_1 = NULL;
 	Comparison_1_t1E2D8261CC6BDF2163403F266C5410F5D18FABE0* G_B1_0 = NULL;
@@ -10065,7 +10067,8 @@ IL_0212:
 		NullCheck(L_90);
 		ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C* L_91;
 		L_91 = VisualElement_get_computedStyle_m8124059EC4D72CCEDE7107FFF72A614131604C3A(L_90, NULL);
-		goto IL_0257;
+		G_B32_0 = L_91;
+		goto IL_025d;
 	}
 
 IL_0250:
@@ -10077,34 +10080,31 @@ IL_0250:
 		goto IL_025d;
 	}
 
-IL_0257:
-	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_93 = V_3;
-		NullCheck(L_93);
-		ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C* L_94;
-		L_94 = VisualElement_get_computedStyle_m8124059EC4D72CCEDE7107FFF72A614131604C3A(L_93, NULL);
-		G_B32_0 = L_94;
-	}
-
 IL_025d:
 	{
 		V_23 = G_B32_0;
-		ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C* L_95 = V_23;
-		ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C L_96;
-		L_96 = ComputedStyle_Create_mA5675A694C2C8504C871B64F01DAE3950EC14A6D(L_95, NULL);
-		V_6 = L_96;
-		int64_t L_97 = V_0;
-		(&V_6)->___matchingRulesHash = L_97;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_98 = ___0_element;
-		NullCheck(L_98);
-		float L_99;
-		L_99 = VisualElement_get_scaledPixelsPerPoint_m44984C56A992E21CE90E3DC15136DDF7DCDA11CD(L_98, NULL);
-		V_24 = L_99;
-		List_1_tA1D3D4FCA4CFF8E02845F48D747A4C704D4C9CAE* L_100 = ___1_matchingSelectors;
-		NullCheck(L_100);
-		Enumerator_t4D71533BFF7D546FC7EB99A4D25A5233CF4684D2 L_101;
-		L_101 = List_1_GetEnumerator_m0C114D820AC2D6FF3B90A7BF84EC8257BA93C06B(L_100, List_1_GetEnumerator_m0C114D820AC2D6FF3B90A7BF84EC8257BA93C06B_RuntimeMethod_var);
-		V_25 = L_101;
+		ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C* L_93 = V_23;
+		ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C L_94;
+		L_94 = ComputedStyle_Create_mA5675A694C2C8504C871B64F01DAE3950EC14A6D(L_93, NULL);
+		V_6 = L_94;
+		int64_t L_95 = V_0;
+		(&V_6)->___matchingRulesHash = L_95;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_96 = ___0_element;
+		NullCheck(L_96);
+		float L_97;
+		L_97 = VisualElement_get_scaledPixelsPerPoint_m44984C56A992E21CE90E3DC15136DDF7DCDA11CD(L_96, NULL);
+		V_24 = L_97;
+		StylePropertyReader_tA960AF3A0C411045E92E04E997D7EB2EF1B7552A* L_98 = __this->___m_StylePropertyReader;
+		V_28 = L_98;
+		StyleMatchingContext_tF3A1D3569F8EEB1C549CEAE4998224A60A0A5D26* L_99 = __this->___m_StyleMatchingContext;
+		NullCheck(L_99);
+		StyleVariableContext_tF74F2787CE1F6BEBBFBFF0771CF493AC9E403527* L_100 = L_99->___variableContext;
+		V_29 = L_100;
+		List_1_tA1D3D4FCA4CFF8E02845F48D747A4C704D4C9CAE* L_101 = ___1_matchingSelectors;
+		NullCheck(L_101);
+		Enumerator_t4D71533BFF7D546FC7EB99A4D25A5233CF4684D2 L_102;
+		L_102 = List_1_GetEnumerator_m0C114D820AC2D6FF3B90A7BF84EC8257BA93C06B(L_101, List_1_GetEnumerator_m0C114D820AC2D6FF3B90A7BF84EC8257BA93C06B_RuntimeMethod_var);
+		V_25 = L_102;
 	}
 	{
 		auto __finallyBlock = il2cpp::utils::Finally([&]
@@ -10124,21 +10124,19 @@ FINALLY_02d0:
 
 IL_0283_1:
 			{
-				SelectorMatchRecord_t1E93CDB54312CFB4A67768BB25ABB9AFB31BC5D7 L_102;
-				L_102 = Enumerator_get_Current_mEFB5475B24F1D9A32001AFA4D24E100190A30CC5_inline((&V_25), Enumerator_get_Current_mEFB5475B24F1D9A32001AFA4D24E100190A30CC5_RuntimeMethod_var);
-				V_26 = L_102;
-				StylePropertyReader_tA960AF3A0C411045E92E04E997D7EB2EF1B7552A* L_103 = __this->___m_StylePropertyReader;
-				SelectorMatchRecord_t1E93CDB54312CFB4A67768BB25ABB9AFB31BC5D7 L_104 = V_26;
-				StyleSheet_t6FAF43FCDB45BC6BED0522A222FD4C1A9BB10428* L_105 = L_104.___sheet;
-				SelectorMatchRecord_t1E93CDB54312CFB4A67768BB25ABB9AFB31BC5D7 L_106 = V_26;
-				StyleComplexSelector_tE46C29F65FDBA48D3152781187401C8B55B7D8AD* L_107 = L_106.___complexSelector;
-				StyleMatchingContext_tF3A1D3569F8EEB1C549CEAE4998224A60A0A5D26* L_108 = __this->___m_StyleMatchingContext;
-				NullCheck(L_108);
-				StyleVariableContext_tF74F2787CE1F6BEBBFBFF0771CF493AC9E403527* L_109 = L_108->___variableContext;
+				SelectorMatchRecord_t1E93CDB54312CFB4A67768BB25ABB9AFB31BC5D7 L_103;
+				L_103 = Enumerator_get_Current_mEFB5475B24F1D9A32001AFA4D24E100190A30CC5_inline((&V_25), Enumerator_get_Current_mEFB5475B24F1D9A32001AFA4D24E100190A30CC5_RuntimeMethod_var);
+				V_26 = L_103;
+				StylePropertyReader_tA960AF3A0C411045E92E04E997D7EB2EF1B7552A* L_104 = V_28;
+				SelectorMatchRecord_t1E93CDB54312CFB4A67768BB25ABB9AFB31BC5D7 L_105 = V_26;
+				StyleSheet_t6FAF43FCDB45BC6BED0522A222FD4C1A9BB10428* L_106 = L_105.___sheet;
+				SelectorMatchRecord_t1E93CDB54312CFB4A67768BB25ABB9AFB31BC5D7 L_107 = V_26;
+				StyleComplexSelector_tE46C29F65FDBA48D3152781187401C8B55B7D8AD* L_108 = L_107.___complexSelector;
+				StyleVariableContext_tF74F2787CE1F6BEBBFBFF0771CF493AC9E403527* L_109 = V_29;
 				float L_110 = V_24;
-				NullCheck(L_103);
-				StylePropertyReader_SetContext_m5A9A1F3B8137480F75DFFCA00A42F45CDB68CC00(L_103, L_105, L_107, L_109, L_110, NULL);
-				StylePropertyReader_tA960AF3A0C411045E92E04E997D7EB2EF1B7552A* L_111 = __this->___m_StylePropertyReader;
+				NullCheck(L_104);
+				StylePropertyReader_SetContext_m5A9A1F3B8137480F75DFFCA00A42F45CDB68CC00(L_104, L_106, L_108, L_109, L_110, NULL);
+				StylePropertyReader_tA960AF3A0C411045E92E04E997D7EB2EF1B7552A* L_111 = V_28;
 				ComputedStyle_t8B08CCCEE20525528B3FFDAC6D3F58F101AAF54C* L_112 = V_23;
 				ComputedStyle_ApplyProperties_m3A2839DA1B85307F21A075C3049B08FC02F33ACC((&V_6), L_111, L_112, NULL);
 			}
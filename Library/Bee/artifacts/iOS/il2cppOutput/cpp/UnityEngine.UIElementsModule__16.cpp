@@ -12373,6 +12373,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void VisualChangesProcessor_DepthFirstOnVisua
 	int32_t V_12 = 0;
 	int32_t V_13 = 0;
 	bool V_14 = false;
+	VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* V_15 = NULL;
 	int32_t G_B12_0 = 0;
 	int32_t G_B19_0 = 0;
 	{
@@ -12540,6 +12541,7 @@ IL_00be:
 		V_6 = L_47;
 		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_48;
 		L_48 = Hierarchy_get_parent_m1CB3F7548632A5B5747041AF64B12BB0E0F402D4((&V_6), NULL);
+		V_15 = L_48;
 		if (!L_48)
 		{
 			goto IL_0134;
@@ -12550,31 +12552,25 @@ IL_00be:
 		NullCheck(L_49);
 		RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847* L_50 = (RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847*)(&L_49->___renderChainData);
 		BMPAlloc_t29DA9D09157B8BAD2D5643711A53A5F11D216D30* L_51 = (BMPAlloc_t29DA9D09157B8BAD2D5643711A53A5F11D216D30*)(&L_50->___transformID);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_52 = ___0_ve;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_52 = V_15;
 		NullCheck(L_52);
-		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_53;
-		L_53 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_52, NULL);
-		V_6 = L_53;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_54;
-		L_54 = Hierarchy_get_parent_m1CB3F7548632A5B5747041AF64B12BB0E0F402D4((&V_6), NULL);
-		NullCheck(L_54);
-		RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847* L_55 = (RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847*)(&L_54->___renderChainData);
-		BMPAlloc_t29DA9D09157B8BAD2D5643711A53A5F11D216D30 L_56 = L_55->___transformID;
+		RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847* L_53 = (RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847*)(&L_52->___renderChainData);
+		BMPAlloc_t29DA9D09157B8BAD2D5643711A53A5F11D216D30 L_54 = L_53->___transformID;
 		il2cpp_codegen_runtime_class_init_inline(BMPAlloc_t29DA9D09157B8BAD2D5643711A53A5F11D216D30_il2cpp_TypeInfo_var);
-		bool L_57;
-		L_57 = BMPAlloc_Equals_mEF900F6B5AD18B63BA66A219DECD6A1BFC83B9A0(L_51, L_56, NULL);
-		if (L_57)
+		bool L_55;
+		L_55 = BMPAlloc_Equals_mEF900F6B5AD18B63BA66A219DECD6A1BFC83B9A0(L_51, L_54, NULL);
+		if (L_55)
 		{
 			goto IL_0134;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_58 = ___0_ve;
-		NullCheck(L_58);
-		RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847* L_59 = (RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847*)(&L_58->___renderChainData);
-		bool L_60;
-		L_60 = RenderChainVEData_get_isGroupTransform_mABD67231AE15C42533EFAAC4E482F0C315590D9F_inline(L_59, NULL);
-		G_B19_0 = ((int32_t)(L_60));
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_56 = ___0_ve;
+		NullCheck(L_56);
+		RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847* L_57 = (RenderChainVEData_t582DE9DA38C6B608A9A38286FCF6FA70398B5847*)(&L_56->___renderChainData);
+		bool L_58;
+		L_58 = RenderChainVEData_get_isGroupTransform_mABD67231AE15C42533EFAAC4E482F0C315590D9F_inline(L_57, NULL);
+		G_B19_0 = ((int32_t)(L_58));
 		goto IL_0135;
 	}
 
@@ -12587,131 +12583,131 @@ IL_0135:
 	{
 		il2cpp_codegen_runtime_class_init_inline(Debug_t8394C7EEAECA3689C2C9B9DE9C7166D73596276F_il2cpp_TypeInfo_var);
 		Debug_Assert_m6E778CACD0F440E2DEA9ACDD9330A22DAF16E96D((bool)G_B19_0, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_61 = ___0_ve;
-		V_7 = (bool)((!(((RuntimeObject*)(TextElement_tD56C5044CCC5552285DC8A9950CC60448C80FEE0*)((TextElement_tD56C5044CCC5552285DC8A9950CC60448C80FEE0*)IsInstClass((RuntimeObject*)L_61, TextElement_tD56C5044CCC5552285DC8A9950CC60448C80FEE0_il2cpp_TypeInfo_var))) <= ((RuntimeObject*)(RuntimeObject*)NULL)))? 1 : 0);
-		bool L_62 = V_7;
-		if (!L_62)
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_59 = ___0_ve;
+		V_7 = (bool)((!(((RuntimeObject*)(TextElement_tD56C5044CCC5552285DC8A9950CC60448C80FEE0*)((TextElement_tD56C5044CCC5552285DC8A9950CC60448C80FEE0*)IsInstClass((RuntimeObject*)L_59, TextElement_tD56C5044CCC5552285DC8A9950CC60448C80FEE0_il2cpp_TypeInfo_var))) <= ((RuntimeObject*)(RuntimeObject*)NULL)))? 1 : 0);
+		bool L_60 = V_7;
+		if (!L_60)
 		{
 			goto IL_0157;
 		}
 	}
 	{
-		RenderChain_tCCA9360D5721E675E5632E4B2F4AF7CDC453E363* L_63 = __this->___m_RenderChain;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_64 = ___0_ve;
+		RenderChain_tCCA9360D5721E675E5632E4B2F4AF7CDC453E363* L_61 = __this->___m_RenderChain;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_62 = ___0_ve;
 		il2cpp_codegen_runtime_class_init_inline(RenderEvents_t05AE607F81A59EC3689391DCA90421F5BF2EE3E1_il2cpp_TypeInfo_var);
-		bool L_65;
-		L_65 = RenderEvents_UpdateTextCoreSettings_m2F3CE9F913F443D99CEB87572D980D49662F6266(L_63, L_64, NULL);
+		bool L_63;
+		L_63 = RenderEvents_UpdateTextCoreSettings_m2F3CE9F913F443D99CEB87572D980D49662F6266(L_61, L_62, NULL);
 	}
 
 IL_0157:
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_66 = ___0_ve;
-		NullCheck(L_66);
-		int32_t L_67;
-		L_67 = VisualElement_get_renderHints_m8D75B152BC6DFD5BB57EAF00270109EE6B993114(L_66, NULL);
-		V_8 = (bool)((((int32_t)((int32_t)((int32_t)L_67&((int32_t)16)))) == ((int32_t)((int32_t)16)))? 1 : 0);
-		bool L_68 = V_8;
-		if (!L_68)
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_64 = ___0_ve;
+		NullCheck(L_64);
+		int32_t L_65;
+		L_65 = VisualElement_get_renderHints_m8D75B152BC6DFD5BB57EAF00270109EE6B993114(L_64, NULL);
+		V_8 = (bool)((((int32_t)((int32_t)((int32_t)L_65&((int32_t)16)))) == ((int32_t)((int32_t)16)))? 1 : 0);
+		bool L_66 = V_8;
+		if (!L_66)
 		{
 			goto IL_0177;
 		}
 	}
 	{
-		RenderChain_tCCA9360D5721E675E5632E4B2F4AF7CDC453E363* L_69 = __this->___m_RenderChain;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_70 = ___0_ve;
+		RenderChain_tCCA9360D5721E675E5632E4B2F4AF7CDC453E363* L_67 = __this->___m_RenderChain;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_68 = ___0_ve;
 		il2cpp_codegen_runtime_class_init_inline(RenderEvents_t05AE607F81A59EC3689391DCA90421F5BF2EE3E1_il2cpp_TypeInfo_var);
-		RenderEvents_SetColorValues_m81D9C11D04DC900B213D895EF096E74ABD42CFBF(L_69, L_70, NULL);
+		RenderEvents_SetColorValues_m81D9C11D04DC900B213D895EF096E74ABD42CFBF(L_67, L_68, NULL);
 	}
 
 IL_0177:
 	{
-		RenderChain_tCCA9360D5721E675E5632E4B2F4AF7CDC453E363* L_71 = __this->___m_RenderChain;
-		NullCheck(L_71);
-		EntryPool_tA3C5BA5AF7ABD15DF12312C1C7F232CD705F3951* L_72;
-		L_72 = RenderChain_get_entryPool_m0B96B64417C44D345D367473962CA43734E7F5C8_inline(L_71, NULL);
+		RenderChain_tCCA9360D5721E675E5632E4B2F4AF7CDC453E363* L_69 = __this->___m_RenderChain;
+		NullCheck(L_69);
+		EntryPool_tA3C5BA5AF7ABD15DF12312C1C7F232CD705F3951* L_70;
+		L_70 = RenderChain_get_entryPool_m0B96B64417C44D345D367473962CA43734E7F5C8_inline(L_69, NULL);
+		NullCheck(L_70);
+		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_71;
+		L_71 = EntryPool_Get_mD20A653A2B9D8DF5D91DA5F7985A71842EF362E4(L_70, NULL);
+		V_0 = L_71;
+		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_72 = V_0;
 		NullCheck(L_72);
-		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_73;
-		L_73 = EntryPool_Get_mD20A653A2B9D8DF5D91DA5F7985A71842EF362E4(L_72, NULL);
-		V_0 = L_73;
-		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_74 = V_0;
-		NullCheck(L_74);
-		L_74->___type = ((int32_t)22);
-		List_1_t4B92347C34A27542DDD64956FA9A5E3C66FD599F* L_75 = __this->___m_EntryProcessingList;
+		L_72->___type = ((int32_t)22);
+		List_1_t4B92347C34A27542DDD64956FA9A5E3C66FD599F* L_73 = __this->___m_EntryProcessingList;
 		il2cpp_codegen_initobj((&V_9), sizeof(EntryProcessingInfo_t087A9D95B60BC4FE30163E435406F6CFE3084B76));
 		(&V_9)->___type = 0;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_76 = ___0_ve;
-		(&V_9)->___visualElement = L_76;
-		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___visualElement), (void*)L_76);
-		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_77 = V_0;
-		(&V_9)->___rootEntry = L_77;
-		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___rootEntry), (void*)L_77);
-		EntryProcessingInfo_t087A9D95B60BC4FE30163E435406F6CFE3084B76 L_78 = V_9;
-		NullCheck(L_75);
-		List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_inline(L_75, L_78, List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_RuntimeMethod_var);
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_74 = ___0_ve;
+		(&V_9)->___visualElement = L_74;
+		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___visualElement), (void*)L_74);
+		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_75 = V_0;
+		(&V_9)->___rootEntry = L_75;
+		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___rootEntry), (void*)L_75);
+		EntryProcessingInfo_t087A9D95B60BC4FE30163E435406F6CFE3084B76 L_76 = V_9;
+		NullCheck(L_73);
+		List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_inline(L_73, L_76, List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_RuntimeMethod_var);
 		il2cpp_codegen_runtime_class_init_inline(VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_il2cpp_TypeInfo_var);
-		ProfilerMarker_tA256E18DA86EDBC5528CE066FC91C96EE86501AD L_79 = ((VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_StaticFields*)il2cpp_codegen_static_fields_for(VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_il2cpp_TypeInfo_var))->___k_GenerateEntriesMarker;
-		V_10 = L_79;
+		ProfilerMarker_tA256E18DA86EDBC5528CE066FC91C96EE86501AD L_77 = ((VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_StaticFields*)il2cpp_codegen_static_fields_for(VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_il2cpp_TypeInfo_var))->___k_GenerateEntriesMarker;
+		V_10 = L_77;
 		ProfilerMarker_Begin_mD07DB736ADA7D8BAF9D969CC7F3C55848A218C6E_inline((&V_10), NULL);
-		MeshGenerationContext_tD1BD8DB52C7126A7987DE5DF1A4AF47A906EAF62* L_80 = __this->___m_MeshGenerationContext;
-		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_81 = V_0;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_82 = ___0_ve;
-		NullCheck(L_80);
-		MeshGenerationContext_Begin_m8F813683B58B8FD5BCC3FEFB3EF6127A509D22C7(L_80, L_81, L_82, NULL);
-		BaseElementBuilder_t7AD7947872717E2F4C56F8A02A656F63A563DAFE* L_83 = __this->___m_ElementBuilder;
-		MeshGenerationContext_tD1BD8DB52C7126A7987DE5DF1A4AF47A906EAF62* L_84 = __this->___m_MeshGenerationContext;
+		MeshGenerationContext_tD1BD8DB52C7126A7987DE5DF1A4AF47A906EAF62* L_78 = __this->___m_MeshGenerationContext;
+		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_79 = V_0;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_80 = ___0_ve;
+		NullCheck(L_78);
+		MeshGenerationContext_Begin_m8F813683B58B8FD5BCC3FEFB3EF6127A509D22C7(L_78, L_79, L_80, NULL);
+		BaseElementBuilder_t7AD7947872717E2F4C56F8A02A656F63A563DAFE* L_81 = __this->___m_ElementBuilder;
+		MeshGenerationContext_tD1BD8DB52C7126A7987DE5DF1A4AF47A906EAF62* L_82 = __this->___m_MeshGenerationContext;
+		NullCheck(L_81);
+		BaseElementBuilder_Build_mE6EDC124200B43F475E053C1BA3285626CFDBAE4(L_81, L_82, NULL);
+		MeshGenerationContext_tD1BD8DB52C7126A7987DE5DF1A4AF47A906EAF62* L_83 = __this->___m_MeshGenerationContext;
 		NullCheck(L_83);
-		BaseElementBuilder_Build_mE6EDC124200B43F475E053C1BA3285626CFDBAE4(L_83, L_84, NULL);
-		MeshGenerationContext_tD1BD8DB52C7126A7987DE5DF1A4AF47A906EAF62* L_85 = __this->___m_MeshGenerationContext;
-		NullCheck(L_85);
-		MeshGenerationContext_End_mE8610A0108D65B726716F089D23E0E1BABA1ED55(L_85, NULL);
-		ProfilerMarker_tA256E18DA86EDBC5528CE066FC91C96EE86501AD L_86 = ((VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_StaticFields*)il2cpp_codegen_static_fields_for(VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_il2cpp_TypeInfo_var))->___k_GenerateEntriesMarker;
-		V_10 = L_86;
+		MeshGenerationContext_End_mE8610A0108D65B726716F089D23E0E1BABA1ED55(L_83, NULL);
+		ProfilerMarker_tA256E18DA86EDBC5528CE066FC91C96EE86501AD L_84 = ((VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_StaticFields*)il2cpp_codegen_static_fields_for(VisualChangesProcessor_t67E3A29CA8EBF8A82C32EDDC7DDD60DD310C7F12_il2cpp_TypeInfo_var))->___k_GenerateEntriesMarker;
+		V_10 = L_84;
 		ProfilerMarker_End_m025AE3EF0F96F6DADC53489A53FC6EE65073DE60_inline((&V_10), NULL);
-		bool L_87 = ___2_hierarchical;
-		V_11 = L_87;
-		bool L_88 = V_11;
-		if (!L_88)
+		bool L_85 = ___2_hierarchical;
+		V_11 = L_85;
+		bool L_86 = V_11;
+		if (!L_86)
 		{
 			goto IL_0255;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_89 = ___0_ve;
-		NullCheck(L_89);
-		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_90;
-		L_90 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_89, NULL);
-		V_6 = L_90;
-		int32_t L_91;
-		L_91 = Hierarchy_get_childCount_mAD31B42C0FF9B64AAF6A8CF23F22024B3F9542D5((&V_6), NULL);
-		V_12 = L_91;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_87 = ___0_ve;
+		NullCheck(L_87);
+		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_88;
+		L_88 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_87, NULL);
+		V_6 = L_88;
+		int32_t L_89;
+		L_89 = Hierarchy_get_childCount_mAD31B42C0FF9B64AAF6A8CF23F22024B3F9542D5((&V_6), NULL);
+		V_12 = L_89;
 		V_13 = 0;
 		goto IL_0248;
 	}
 
 IL_0226:
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_92 = ___0_ve;
-		NullCheck(L_92);
-		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_93;
-		L_93 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_92, NULL);
-		V_6 = L_93;
-		int32_t L_94 = V_13;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_95;
-		L_95 = Hierarchy_get_Item_mBA5811C28D9E7FA48D0F10603A95F8CF248C3467((&V_6), L_94, NULL);
-		uint32_t L_96 = ___1_dirtyID;
-		ChainBuilderStats_t6E755490CE0B312AE16FEBC6734C7F2836A8067C* L_97 = ___3_stats;
-		VisualChangesProcessor_DepthFirstOnVisualsChanged_mF7C8860F519C96DAECADFA5DCD5A56340D2A991C(__this, L_95, L_96, (bool)1, L_97, NULL);
-		int32_t L_98 = V_13;
-		V_13 = ((int32_t)il2cpp_codegen_add(L_98, 1));
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_90 = ___0_ve;
+		NullCheck(L_90);
+		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_91;
+		L_91 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_90, NULL);
+		V_6 = L_91;
+		int32_t L_92 = V_13;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_93;
+		L_93 = Hierarchy_get_Item_mBA5811C28D9E7FA48D0F10603A95F8CF248C3467((&V_6), L_92, NULL);
+		uint32_t L_94 = ___1_dirtyID;
+		ChainBuilderStats_t6E755490CE0B312AE16FEBC6734C7F2836A8067C* L_95 = ___3_stats;
+		VisualChangesProcessor_DepthFirstOnVisualsChanged_mF7C8860F519C96DAECADFA5DCD5A56340D2A991C(__this, L_93, L_94, (bool)1, L_95, NULL);
+		int32_t L_96 = V_13;
+		V_13 = ((int32_t)il2cpp_codegen_add(L_96, 1));
 	}
 
 IL_0248:
 	{
-		int32_t L_99 = V_13;
-		int32_t L_100 = V_12;
-		V_14 = (bool)((((int32_t)L_99) < ((int32_t)L_100))? 1 : 0);
-		bool L_101 = V_14;
-		if (L_101)
+		int32_t L_97 = V_13;
+		int32_t L_98 = V_12;
+		V_14 = (bool)((((int32_t)L_97) < ((int32_t)L_98))? 1 : 0);
+		bool L_99 = V_14;
+		if (L_99)
 		{
 			goto IL_0226;
 		}
@@ -12721,18 +12717,18 @@ IL_0248:
 
 IL_0255:
 	{
-		List_1_t4B92347C34A27542DDD64956FA9A5E3C66FD599F* L_102 = __this->___m_EntryProcessingList;
+		List_1_t4B92347C34A27542DDD64956FA9A5E3C66FD599F* L_100 = __this->___m_EntryProcessingList;
 		il2cpp_codegen_initobj((&V_9), sizeof(EntryProcessingInfo_t087A9D95B60BC4FE30163E435406F6CFE3084B76));
 		(&V_9)->___type = 1;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_103 = ___0_ve;
-		(&V_9)->___visualElement = L_103;
-		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___visualElement), (void*)L_103);
-		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_104 = V_0;
-		(&V_9)->___rootEntry = L_104;
-		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___rootEntry), (void*)L_104);
-		EntryProcessingInfo_t087A9D95B60BC4FE30163E435406F6CFE3084B76 L_105 = V_9;
-		NullCheck(L_102);
-		List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_inline(L_102, L_105, List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_RuntimeMethod_var);
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_101 = ___0_ve;
+		(&V_9)->___visualElement = L_101;
+		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___visualElement), (void*)L_101);
+		Entry_t475ED76E31923970E7F7A6522E570E7577C487B9* L_102 = V_0;
+		(&V_9)->___rootEntry = L_102;
+		Il2CppCodeGenWriteBarrier((void**)(&(&V_9)->___rootEntry), (void*)L_102);
+		EntryProcessingInfo_t087A9D95B60BC4FE30163E435406F6CFE3084B76 L_103 = V_9;
+		NullCheck(L_100);
+		List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_inline(L_100, L_103, List_1_Add_m8C7E29B8E226EFCAF030759710276AA65A95DB3F_RuntimeMethod_var);
 	}
 
 IL_0283:
@@ -28130,6 +28130,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void UIRLayoutUpdater_UpdateSubTree_mD6001F96
 	bool V_26 = false;
 	bool V_27 = false;
 	bool V_28 = false;
+	LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* V_29 = NULL;
 	int32_t G_B13_0 = 0;
 	int32_t G_B29_0 = 0;
 	List_1_t7C5E9C6E62F8D4C4EF03FB438CAE0AE969A07CF9* G_B32_0 = NULL;
@@ -28165,202 +28166,182 @@ IL_001e:
 		NullCheck(L_6);
 		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_7;
 		L_7 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_6, NULL);
+		V_29 = L_7;
 		float L_8;
 		L_8 = LayoutNode_get_LayoutX_m83F9837DEE556DD1C65DE378E8A63DB0A19D2C9B(L_7, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_9 = ___0_ve;
-		NullCheck(L_9);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_10;
-		L_10 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_9, NULL);
-		float L_11;
-		L_11 = LayoutNode_get_LayoutY_m601CFB3DDF847E860A95164E4221115CB8A7049C(L_10, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_12 = ___0_ve;
-		NullCheck(L_12);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_13;
-		L_13 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_12, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_9 = V_29;
+		float L_10;
+		L_10 = LayoutNode_get_LayoutY_m601CFB3DDF847E860A95164E4221115CB8A7049C(L_9, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_11 = V_29;
+		float L_12;
+		L_12 = LayoutNode_get_LayoutWidth_m1DB31B5E1756AEFB4B097E9218C69FAEFAF17808(L_11, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_13 = V_29;
 		float L_14;
-		L_14 = LayoutNode_get_LayoutWidth_m1DB31B5E1756AEFB4B097E9218C69FAEFAF17808(L_13, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_15 = ___0_ve;
-		NullCheck(L_15);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_16;
-		L_16 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_15, NULL);
-		float L_17;
-		L_17 = LayoutNode_get_LayoutHeight_mFA7066B4C797B076AF941316CE5031CE0E391CD4(L_16, NULL);
-		Rect__ctor_m18C3033D135097BEE424AAA68D91C706D2647F23_inline((&V_1), L_8, L_11, L_14, L_17, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_18 = ___0_ve;
-		NullCheck(L_18);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_19;
-		L_19 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_18, NULL);
+		L_14 = LayoutNode_get_LayoutHeight_mFA7066B4C797B076AF941316CE5031CE0E391CD4(L_13, NULL);
+		Rect__ctor_m18C3033D135097BEE424AAA68D91C706D2647F23_inline((&V_1), L_8, L_10, L_12, L_14, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_15 = V_29;
+		float L_16;
+		L_16 = LayoutNode_get_LayoutPaddingLeft_mBB7778BCC08C5C29D01D74AFA68753D135DD2C88(L_15, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_17 = V_29;
+		float L_18;
+		L_18 = LayoutNode_get_LayoutPaddingLeft_mBB7778BCC08C5C29D01D74AFA68753D135DD2C88(L_17, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_19 = V_29;
 		float L_20;
-		L_20 = LayoutNode_get_LayoutPaddingLeft_mBB7778BCC08C5C29D01D74AFA68753D135DD2C88(L_19, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_21 = ___0_ve;
-		NullCheck(L_21);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_22;
-		L_22 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_21, NULL);
+		L_20 = LayoutNode_get_LayoutPaddingRight_mE480032D46D3B09F742080381B51B01021B5517F(L_19, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_21 = V_29;
+		float L_22;
+		L_22 = LayoutNode_get_LayoutPaddingBottom_m849508225C1553F3374E0C582428D512F6D673A7(L_21, NULL);
+		Rect__ctor_m18C3033D135097BEE424AAA68D91C706D2647F23_inline((&V_2), L_16, L_18, L_20, L_22, NULL);
 		float L_23;
-		L_23 = LayoutNode_get_LayoutPaddingLeft_mBB7778BCC08C5C29D01D74AFA68753D135DD2C88(L_22, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_24 = ___0_ve;
-		NullCheck(L_24);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_25;
-		L_25 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_24, NULL);
+		L_23 = Rect_get_x_mB267B718E0D067F2BAE31BA477647FBF964916EB_inline((&V_2), NULL);
+		float L_24;
+		L_24 = Rect_get_y_mC733E8D49F3CE21B2A3D40A1B72D687F22C97F49_inline((&V_2), NULL);
+		float L_25;
+		L_25 = Rect_get_width_m620D67551372073C9C32C4C4624C2A5713F7F9A9_inline((&V_1), NULL);
 		float L_26;
-		L_26 = LayoutNode_get_LayoutPaddingRight_mE480032D46D3B09F742080381B51B01021B5517F(L_25, NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_27 = ___0_ve;
-		NullCheck(L_27);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_28;
-		L_28 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_27, NULL);
+		L_26 = Rect_get_x_mB267B718E0D067F2BAE31BA477647FBF964916EB_inline((&V_2), NULL);
+		float L_27;
+		L_27 = Rect_get_width_m620D67551372073C9C32C4C4624C2A5713F7F9A9_inline((&V_2), NULL);
+		float L_28;
+		L_28 = Rect_get_height_mE1AA6C6C725CCD2D317BD2157396D3CF7D47C9D8_inline((&V_1), NULL);
 		float L_29;
-		L_29 = LayoutNode_get_LayoutPaddingBottom_m849508225C1553F3374E0C582428D512F6D673A7(L_28, NULL);
-		Rect__ctor_m18C3033D135097BEE424AAA68D91C706D2647F23_inline((&V_2), L_20, L_23, L_26, L_29, NULL);
+		L_29 = Rect_get_y_mC733E8D49F3CE21B2A3D40A1B72D687F22C97F49_inline((&V_2), NULL);
 		float L_30;
-		L_30 = Rect_get_x_mB267B718E0D067F2BAE31BA477647FBF964916EB_inline((&V_2), NULL);
-		float L_31;
-		L_31 = Rect_get_y_mC733E8D49F3CE21B2A3D40A1B72D687F22C97F49_inline((&V_2), NULL);
-		float L_32;
-		L_32 = Rect_get_width_m620D67551372073C9C32C4C4624C2A5713F7F9A9_inline((&V_1), NULL);
-		float L_33;
-		L_33 = Rect_get_x_mB267B718E0D067F2BAE31BA477647FBF964916EB_inline((&V_2), NULL);
-		float L_34;
-		L_34 = Rect_get_width_m620D67551372073C9C32C4C4624C2A5713F7F9A9_inline((&V_2), NULL);
-		float L_35;
-		L_35 = Rect_get_height_mE1AA6C6C725CCD2D317BD2157396D3CF7D47C9D8_inline((&V_1), NULL);
-		float L_36;
-		L_36 = Rect_get_y_mC733E8D49F3CE21B2A3D40A1B72D687F22C97F49_inline((&V_2), NULL);
-		float L_37;
-		L_37 = Rect_get_height_mE1AA6C6C725CCD2D317BD2157396D3CF7D47C9D8_inline((&V_2), NULL);
-		Rect__ctor_m18C3033D135097BEE424AAA68D91C706D2647F23_inline((&V_3), L_30, L_31, ((float)il2cpp_codegen_subtract(L_32, ((float)il2cpp_codegen_add(L_33, L_34)))), ((float)il2cpp_codegen_subtract(L_35, ((float)il2cpp_codegen_add(L_36, L_37)))), NULL);
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_38 = ___0_ve;
-		NullCheck(L_38);
-		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_39 = L_38->___lastLayout;
-		V_4 = L_39;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_40 = ___0_ve;
-		NullCheck(L_40);
-		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_41 = L_40->___lastPseudoPadding;
-		V_5 = L_41;
+		L_30 = Rect_get_height_mE1AA6C6C725CCD2D317BD2157396D3CF7D47C9D8_inline((&V_2), NULL);
+		Rect__ctor_m18C3033D135097BEE424AAA68D91C706D2647F23_inline((&V_3), L_23, L_24, ((float)il2cpp_codegen_subtract(L_25, ((float)il2cpp_codegen_add(L_26, L_27)))), ((float)il2cpp_codegen_subtract(L_28, ((float)il2cpp_codegen_add(L_29, L_30)))), NULL);
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_31 = ___0_ve;
+		NullCheck(L_31);
+		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_32 = L_31->___lastLayout;
+		V_4 = L_32;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_33 = ___0_ve;
+		NullCheck(L_33);
+		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_34 = L_33->___lastPseudoPadding;
+		V_5 = L_34;
 		V_6 = 0;
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_42;
-		L_42 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_4), NULL);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_43;
-		L_43 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_1), NULL);
-		bool L_44;
-		L_44 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_42, L_43, NULL);
-		V_7 = L_44;
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_45;
-		L_45 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_5), NULL);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_46;
-		L_46 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_3), NULL);
-		bool L_47;
-		L_47 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_45, L_46, NULL);
-		V_8 = L_47;
-		bool L_48 = V_7;
-		bool L_49 = V_8;
-		V_13 = (bool)((int32_t)((int32_t)L_48|(int32_t)L_49));
-		bool L_50 = V_13;
-		if (!L_50)
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_35;
+		L_35 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_4), NULL);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_36;
+		L_36 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_1), NULL);
+		bool L_37;
+		L_37 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_35, L_36, NULL);
+		V_7 = L_37;
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_38;
+		L_38 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_5), NULL);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_39;
+		L_39 = Rect_get_size_mFB990FFC0FE0152179C8C74A59E4AC258CB44267_inline((&V_3), NULL);
+		bool L_40;
+		L_40 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_38, L_39, NULL);
+		V_8 = L_40;
+		bool L_41 = V_7;
+		bool L_42 = V_8;
+		V_13 = (bool)((int32_t)((int32_t)L_41|(int32_t)L_42));
+		bool L_43 = V_13;
+		if (!L_43)
 		{
 			goto IL_0119;
 		}
 	}
 	{
-		int32_t L_51 = V_6;
-		V_6 = ((int32_t)((int32_t)L_51|((int32_t)3072)));
+		int32_t L_44 = V_6;
+		V_6 = ((int32_t)((int32_t)L_44|((int32_t)3072)));
 	}
 
 IL_0119:
 	{
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_52;
-		L_52 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_1), NULL);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_53;
-		L_53 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_4), NULL);
-		bool L_54;
-		L_54 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_52, L_53, NULL);
-		V_9 = L_54;
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_55;
-		L_55 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_3), NULL);
-		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_56;
-		L_56 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_5), NULL);
-		bool L_57;
-		L_57 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_55, L_56, NULL);
-		V_10 = L_57;
-		bool L_58 = V_9;
-		bool L_59 = V_10;
-		bool L_60 = V_0;
-		V_14 = (bool)((int32_t)(((int32_t)((int32_t)L_58|(int32_t)L_59))|(int32_t)L_60));
-		bool L_61 = V_14;
-		if (!L_61)
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_45;
+		L_45 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_1), NULL);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_46;
+		L_46 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_4), NULL);
+		bool L_47;
+		L_47 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_45, L_46, NULL);
+		V_9 = L_47;
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_48;
+		L_48 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_3), NULL);
+		Vector2_t1FD6F485C871E832B347AB2DC8CBA08B739D8DF7 L_49;
+		L_49 = Rect_get_position_m9B7E583E67443B6F4280A676E644BB0B9E7C4E38_inline((&V_5), NULL);
+		bool L_50;
+		L_50 = Vector2_op_Inequality_mBEA93B5A0E954FEFB863DC61CB209119980EC713_inline(L_48, L_49, NULL);
+		V_10 = L_50;
+		bool L_51 = V_9;
+		bool L_52 = V_10;
+		bool L_53 = V_0;
+		V_14 = (bool)((int32_t)(((int32_t)((int32_t)L_51|(int32_t)L_52))|(int32_t)L_53));
+		bool L_54 = V_14;
+		if (!L_54)
 		{
 			goto IL_015a;
 		}
 	}
 	{
-		int32_t L_62 = V_6;
-		V_6 = ((int32_t)((int32_t)L_62|((int32_t)512)));
+		int32_t L_55 = V_6;
+		V_6 = ((int32_t)((int32_t)L_55|((int32_t)512)));
 	}
 
 IL_015a:
 	{
-		bool L_63 = V_0;
-		V_15 = L_63;
-		bool L_64 = V_15;
-		if (!L_64)
+		bool L_56 = V_0;
+		V_15 = L_56;
+		bool L_57 = V_15;
+		if (!L_57)
 		{
 			goto IL_016b;
 		}
 	}
 	{
-		int32_t L_65 = V_6;
-		V_6 = ((int32_t)((int32_t)L_65|((int32_t)1024)));
+		int32_t L_58 = V_6;
+		V_6 = ((int32_t)((int32_t)L_58|((int32_t)1024)));
 	}
 
 IL_016b:
 	{
-		int32_t L_66 = V_6;
-		V_16 = (bool)((((int32_t)((int32_t)((int32_t)L_66&((int32_t)1536)))) == ((int32_t)((int32_t)1024)))? 1 : 0);
-		bool L_67 = V_16;
-		if (!L_67)
+		int32_t L_59 = V_6;
+		V_16 = (bool)((((int32_t)((int32_t)((int32_t)L_59&((int32_t)1536)))) == ((int32_t)((int32_t)1024)))? 1 : 0);
+		bool L_60 = V_16;
+		if (!L_60)
 		{
 			goto IL_01e1;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_68 = ___0_ve;
-		NullCheck(L_68);
-		bool L_69;
-		L_69 = VisualElement_get_hasDefaultRotationAndScale_mBB97B0CFEA46CEB03B2A97E762F2426908E13BE8_inline(L_68, NULL);
-		V_17 = (bool)((((int32_t)L_69) == ((int32_t)0))? 1 : 0);
-		bool L_70 = V_17;
-		if (!L_70)
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_61 = ___0_ve;
+		NullCheck(L_61);
+		bool L_62;
+		L_62 = VisualElement_get_hasDefaultRotationAndScale_mBB97B0CFEA46CEB03B2A97E762F2426908E13BE8_inline(L_61, NULL);
+		V_17 = (bool)((((int32_t)L_62) == ((int32_t)0))? 1 : 0);
+		bool L_63 = V_17;
+		if (!L_63)
 		{
 			goto IL_01e0;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_71 = ___0_ve;
-		NullCheck(L_71);
-		RuntimeObject* L_72;
-		L_72 = VisualElement_get_resolvedStyle_m3885B7534A94E0BCE024A9621465A0F273DA0AEB(L_71, NULL);
-		NullCheck(L_72);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_73;
-		L_73 = InterfaceFuncInvoker0< Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 >::Invoke(53, IResolvedStyle_t6A3530BA6147B091C278593F21F86B09CD42BE89_il2cpp_TypeInfo_var, L_72);
-		float L_74 = L_73.___x;
-		bool L_75;
-		L_75 = Mathf_Approximately_m1DADD012A8FC82E11FB282501AE2EBBF9A77150B_inline(L_74, (0.0f), NULL);
-		if (!L_75)
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_64 = ___0_ve;
+		NullCheck(L_64);
+		RuntimeObject* L_65;
+		L_65 = VisualElement_get_resolvedStyle_m3885B7534A94E0BCE024A9621465A0F273DA0AEB(L_64, NULL);
+		NullCheck(L_65);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_66;
+		L_66 = InterfaceFuncInvoker0< Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 >::Invoke(53, IResolvedStyle_t6A3530BA6147B091C278593F21F86B09CD42BE89_il2cpp_TypeInfo_var, L_65);
+		float L_67 = L_66.___x;
+		bool L_68;
+		L_68 = Mathf_Approximately_m1DADD012A8FC82E11FB282501AE2EBBF9A77150B_inline(L_67, (0.0f), NULL);
+		if (!L_68)
 		{
 			goto IL_01cc;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_76 = ___0_ve;
-		NullCheck(L_76);
-		RuntimeObject* L_77;
-		L_77 = VisualElement_get_resolvedStyle_m3885B7534A94E0BCE024A9621465A0F273DA0AEB(L_76, NULL);
-		NullCheck(L_77);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_78;
-		L_78 = InterfaceFuncInvoker0< Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 >::Invoke(53, IResolvedStyle_t6A3530BA6147B091C278593F21F86B09CD42BE89_il2cpp_TypeInfo_var, L_77);
-		float L_79 = L_78.___y;
-		bool L_80;
-		L_80 = Mathf_Approximately_m1DADD012A8FC82E11FB282501AE2EBBF9A77150B_inline(L_79, (0.0f), NULL);
-		G_B13_0 = ((((int32_t)L_80) == ((int32_t)0))? 1 : 0);
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_69 = ___0_ve;
+		NullCheck(L_69);
+		RuntimeObject* L_70;
+		L_70 = VisualElement_get_resolvedStyle_m3885B7534A94E0BCE024A9621465A0F273DA0AEB(L_69, NULL);
+		NullCheck(L_70);
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_71;
+		L_71 = InterfaceFuncInvoker0< Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 >::Invoke(53, IResolvedStyle_t6A3530BA6147B091C278593F21F86B09CD42BE89_il2cpp_TypeInfo_var, L_70);
+		float L_72 = L_71.___y;
+		bool L_73;
+		L_73 = Mathf_Approximately_m1DADD012A8FC82E11FB282501AE2EBBF9A77150B_inline(L_72, (0.0f), NULL);
+		G_B13_0 = ((((int32_t)L_73) == ((int32_t)0))? 1 : 0);
 		goto IL_01cd;
 	}
 
@@ -28372,15 +28353,15 @@ IL_01cc:
 IL_01cd:
 	{
 		V_18 = (bool)G_B13_0;
-		bool L_81 = V_18;
-		if (!L_81)
+		bool L_74 = V_18;
+		if (!L_74)
 		{
 			goto IL_01df;
 		}
 	}
 	{
-		int32_t L_82 = V_6;
-		V_6 = ((int32_t)((int32_t)L_82|((int32_t)512)));
+		int32_t L_75 = V_6;
+		V_6 = ((int32_t)((int32_t)L_75|((int32_t)512)));
 	}
 
 IL_01df:
@@ -28393,102 +28374,99 @@ IL_01e0:
 
 IL_01e1:
 	{
-		int32_t L_83 = V_6;
-		V_19 = (bool)((!(((uint32_t)L_83) <= ((uint32_t)0)))? 1 : 0);
-		bool L_84 = V_19;
-		if (!L_84)
+		int32_t L_76 = V_6;
+		V_19 = (bool)((!(((uint32_t)L_76) <= ((uint32_t)0)))? 1 : 0);
+		bool L_77 = V_19;
+		if (!L_77)
 		{
 			goto IL_01f5;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_85 = ___0_ve;
-		int32_t L_86 = V_6;
-		NullCheck(L_85);
-		VisualElement_IncrementVersion_m03581665EE480D3C329058FFE08734450493E33E(L_85, L_86, NULL);
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_78 = ___0_ve;
+		int32_t L_79 = V_6;
+		NullCheck(L_78);
+		VisualElement_IncrementVersion_m03581665EE480D3C329058FFE08734450493E33E(L_78, L_79, NULL);
 	}
 
 IL_01f5:
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_87 = ___0_ve;
-		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_88 = V_1;
-		NullCheck(L_87);
-		L_87->___lastLayout = L_88;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_89 = ___0_ve;
-		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_90 = V_3;
-		NullCheck(L_89);
-		L_89->___lastPseudoPadding = L_90;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_91 = ___0_ve;
-		NullCheck(L_91);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_92;
-		L_92 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_91, NULL);
-		bool L_93;
-		L_93 = LayoutNode_get_HasNewLayout_m24625E348BF45B41A0A5B06EA8E2D73D30353743(L_92, NULL);
-		V_11 = L_93;
-		bool L_94 = V_11;
-		V_20 = L_94;
-		bool L_95 = V_20;
-		if (!L_95)
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_80 = ___0_ve;
+		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_81 = V_1;
+		NullCheck(L_80);
+		L_80->___lastLayout = L_81;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_82 = ___0_ve;
+		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_83 = V_3;
+		NullCheck(L_82);
+		L_82->___lastPseudoPadding = L_83;
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_84 = V_29;
+		bool L_85;
+		L_85 = LayoutNode_get_HasNewLayout_m24625E348BF45B41A0A5B06EA8E2D73D30353743(L_84, NULL);
+		V_11 = L_85;
+		bool L_86 = V_11;
+		V_20 = L_86;
+		bool L_87 = V_20;
+		if (!L_87)
 		{
 			goto IL_0273;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_96 = ___0_ve;
-		NullCheck(L_96);
-		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_97;
-		L_97 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_96, NULL);
-		V_22 = L_97;
-		int32_t L_98;
-		L_98 = Hierarchy_get_childCount_mAD31B42C0FF9B64AAF6A8CF23F22024B3F9542D5((&V_22), NULL);
-		V_21 = L_98;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_88 = ___0_ve;
+		NullCheck(L_88);
+		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_89;
+		L_89 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_88, NULL);
+		V_22 = L_89;
+		int32_t L_90;
+		L_90 = Hierarchy_get_childCount_mAD31B42C0FF9B64AAF6A8CF23F22024B3F9542D5((&V_22), NULL);
+		V_21 = L_90;
 		V_23 = 0;
 		goto IL_0266;
 	}
 
 IL_022f:
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_99 = ___0_ve;
-		NullCheck(L_99);
-		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_100;
-		L_100 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_99, NULL);
-		V_22 = L_100;
-		int32_t L_101 = V_23;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_102;
-		L_102 = Hierarchy_get_Item_mBA5811C28D9E7FA48D0F10603A95F8CF248C3467((&V_22), L_101, NULL);
-		V_24 = L_102;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_103 = V_24;
-		NullCheck(L_103);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_104;
-		L_104 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_103, NULL);
-		bool L_105;
-		L_105 = LayoutNode_get_HasNewLayout_m24625E348BF45B41A0A5B06EA8E2D73D30353743(L_104, NULL);
-		V_25 = L_105;
-		bool L_106 = V_25;
-		if (!L_106)
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_91 = ___0_ve;
+		NullCheck(L_91);
+		Hierarchy_t4CF226F0EDE9C117C51C505730FC80641B1F1677 L_92;
+		L_92 = VisualElement_get_hierarchy_m2E897DE4CFD349E65CFA38EFF6BAAFECE2F4E3E4_inline(L_91, NULL);
+		V_22 = L_92;
+		int32_t L_93 = V_23;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_94;
+		L_94 = Hierarchy_get_Item_mBA5811C28D9E7FA48D0F10603A95F8CF248C3467((&V_22), L_93, NULL);
+		V_24 = L_94;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_95 = V_24;
+		NullCheck(L_95);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_96;
+		L_96 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_95, NULL);
+		bool L_97;
+		L_97 = LayoutNode_get_HasNewLayout_m24625E348BF45B41A0A5B06EA8E2D73D30353743(L_96, NULL);
+		V_25 = L_97;
+		bool L_98 = V_25;
+		if (!L_98)
 		{
 			goto IL_025f;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_107 = V_24;
-		List_1_t7C5E9C6E62F8D4C4EF03FB438CAE0AE969A07CF9* L_108 = ___1_changeEvents;
-		UIRLayoutUpdater_UpdateSubTree_mD6001F9697ACA90F3B13BBC4732E928B4F3EB16B(__this, L_107, L_108, NULL);
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_99 = V_24;
+		List_1_t7C5E9C6E62F8D4C4EF03FB438CAE0AE969A07CF9* L_100 = ___1_changeEvents;
+		UIRLayoutUpdater_UpdateSubTree_mD6001F9697ACA90F3B13BBC4732E928B4F3EB16B(__this, L_99, L_100, NULL);
 	}
 
 IL_025f:
 	{
-		int32_t L_109 = V_23;
-		V_23 = ((int32_t)il2cpp_codegen_add(L_109, 1));
+		int32_t L_101 = V_23;
+		V_23 = ((int32_t)il2cpp_codegen_add(L_101, 1));
 	}
 
 IL_0266:
 	{
-		int32_t L_110 = V_23;
-		int32_t L_111 = V_21;
-		V_26 = (bool)((((int32_t)L_110) < ((int32_t)L_111))? 1 : 0);
-		bool L_112 = V_26;
-		if (L_112)
+		int32_t L_102 = V_23;
+		int32_t L_103 = V_21;
+		V_26 = (bool)((((int32_t)L_102) < ((int32_t)L_103))? 1 : 0);
+		bool L_104 = V_26;
+		if (L_104)
 		{
 			goto IL_022f;
 		}
@@ -28498,22 +28476,22 @@ IL_0266:
 
 IL_0273:
 	{
-		bool L_113 = V_7;
-		bool L_114 = V_9;
-		bool L_115 = V_0;
-		if (!((int32_t)(((int32_t)((int32_t)L_113|(int32_t)L_114))|(int32_t)L_115)))
+		bool L_105 = V_7;
+		bool L_106 = V_9;
+		bool L_107 = V_0;
+		if (!((int32_t)(((int32_t)((int32_t)L_105|(int32_t)L_106))|(int32_t)L_107)))
 		{
 			goto IL_0289;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_116 = ___0_ve;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_108 = ___0_ve;
 		il2cpp_codegen_runtime_class_init_inline(EventBase_1_tCDEFDAD598AAC8D3B106EB41834C9619E903374E_il2cpp_TypeInfo_var);
-		int32_t L_117 = ((EventBase_1_tCDEFDAD598AAC8D3B106EB41834C9619E903374E_StaticFields*)il2cpp_codegen_static_fields_for(EventBase_1_tCDEFDAD598AAC8D3B106EB41834C9619E903374E_il2cpp_TypeInfo_var))->___EventCategory;
-		NullCheck(L_116);
-		bool L_118;
-		L_118 = VisualElement_HasSelfEventInterests_m0874883845FA202A6855F9DCE74EDAEA24DCDB60(L_116, L_117, NULL);
-		G_B29_0 = ((int32_t)(L_118));
+		int32_t L_109 = ((EventBase_1_tCDEFDAD598AAC8D3B106EB41834C9619E903374E_StaticFields*)il2cpp_codegen_static_fields_for(EventBase_1_tCDEFDAD598AAC8D3B106EB41834C9619E903374E_il2cpp_TypeInfo_var))->___EventCategory;
+		NullCheck(L_108);
+		bool L_110;
+		L_110 = VisualElement_HasSelfEventInterests_m0874883845FA202A6855F9DCE74EDAEA24DCDB60(L_108, L_109, NULL);
+		G_B29_0 = ((int32_t)(L_110));
 		goto IL_028a;
 	}
 
@@ -28525,64 +28503,61 @@ IL_0289:
 IL_028a:
 	{
 		V_27 = (bool)G_B29_0;
-		bool L_119 = V_27;
-		if (!L_119)
+		bool L_111 = V_27;
+		if (!L_111)
 		{
 			goto IL_02ac;
 		}
 	}
 	{
-		List_1_t7C5E9C6E62F8D4C4EF03FB438CAE0AE969A07CF9* L_120 = ___1_changeEvents;
-		bool L_121 = V_0;
-		if (L_121)
+		List_1_t7C5E9C6E62F8D4C4EF03FB438CAE0AE969A07CF9* L_112 = ___1_changeEvents;
+		bool L_113 = V_0;
+		if (L_113)
 		{
-			G_B32_0 = L_120;
+			G_B32_0 = L_112;
 			goto IL_0299;
 		}
-		G_B31_0 = L_120;
+		G_B31_0 = L_112;
 	}
 	{
-		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_122 = V_4;
-		G_B33_0 = L_122;
+		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_114 = V_4;
+		G_B33_0 = L_114;
 		G_B33_1 = G_B31_0;
 		goto IL_029e;
 	}
 
 IL_0299:
 	{
-		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_123;
-		L_123 = Rect_get_zero_m5341D8B63DEF1F4C308A685EEC8CFEA12A396C8D(NULL);
-		G_B33_0 = L_123;
+		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_115;
+		L_115 = Rect_get_zero_m5341D8B63DEF1F4C308A685EEC8CFEA12A396C8D(NULL);
+		G_B33_0 = L_115;
 		G_B33_1 = G_B32_0;
 	}
 
 IL_029e:
 	{
-		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_124 = V_1;
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_125 = ___0_ve;
-		ValueTuple_3_tFCE08B8569F9E16C6B098364F9CF710B901F71D3 L_126;
-		memset((&L_126), 0, sizeof(L_126));
-		ValueTuple_3__ctor_mA97EDD3D1FDE71CD9BED7E88B6DADF48CA9B380F((&L_126), G_B33_0, L_124, L_125, ValueTuple_3__ctor_mA97EDD3D1FDE71CD9BED7E88B6DADF48CA9B380F_RuntimeMethod_var);
+		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_116 = V_1;
+		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_117 = ___0_ve;
+		ValueTuple_3_tFCE08B8569F9E16C6B098364F9CF710B901F71D3 L_118;
+		memset((&L_118), 0, sizeof(L_118));
+		ValueTuple_3__ctor_mA97EDD3D1FDE71CD9BED7E88B6DADF48CA9B380F((&L_118), G_B33_0, L_116, L_117, ValueTuple_3__ctor_mA97EDD3D1FDE71CD9BED7E88B6DADF48CA9B380F_RuntimeMethod_var);
 		NullCheck(G_B33_1);
-		List_1_Add_m4F8B33B7518438AE96D304734DF598807A29D2DE_inline(G_B33_1, L_126, List_1_Add_m4F8B33B7518438AE96D304734DF598807A29D2DE_RuntimeMethod_var);
+		List_1_Add_m4F8B33B7518438AE96D304734DF598807A29D2DE_inline(G_B33_1, L_118, List_1_Add_m4F8B33B7518438AE96D304734DF598807A29D2DE_RuntimeMethod_var);
 	}
 
 IL_02ac:
 	{
-		bool L_127 = V_11;
-		V_28 = L_127;
-		bool L_128 = V_28;
-		if (!L_128)
+		bool L_119 = V_11;
+		V_28 = L_119;
+		bool L_120 = V_28;
+		if (!L_120)
 		{
 			goto IL_02c2;
 		}
 	}
 	{
-		VisualElement_t2667F9D19E62C7A315927506C06F223AB9234115* L_129 = ___0_ve;
-		NullCheck(L_129);
-		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_130;
-		L_130 = VisualElement_get_layoutNode_mDEB89DEE452812FE70D90C54203C03DC216A66CB(L_129, NULL);
-		LayoutNode_MarkLayoutSeen_m20DE9A54DE8C18D790560DBB760715F364D0E312(L_130, NULL);
+		LayoutNode_tADF081B0F16F76B66459DE38F3AD8EC098F22CBE* L_121 = V_29;
+		LayoutNode_MarkLayoutSeen_m20DE9A54DE8C18D790560DBB760715F364D0E312(L_121, NULL);
 	}
 
 IL_02c2:
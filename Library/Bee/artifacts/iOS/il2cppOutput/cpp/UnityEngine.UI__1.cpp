@@ -20811,6 +20811,7 @@ IL_0037:
 		NullCheck(L_10);
 		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_12;
 		L_12 = List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E(L_10, L_11, List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E_RuntimeMethod_var);
+		V_3 = L_12;
 		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_12, ILayoutSelfController_t0E526AE7F9329BA48E86991F8BBC2C0F6C406CA3_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0052;
@@ -20818,29 +20819,25 @@ IL_0037:
 	}
 	{
 		UnityAction_1_t08643BD289D9DD7E6CD60BA4721F56BE50AF56E7* L_13 = ___1_action;
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_14 = V_0;
-		int32_t L_15 = V_1;
-		NullCheck(L_14);
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_16;
-		L_16 = List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E(L_14, L_15, List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E_RuntimeMethod_var);
+		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_14 = V_3;
 		NullCheck(L_13);
-		UnityAction_1_Invoke_m5A664E7E7EB4C9C10661F12DFFB214DF00DD5A8B_inline(L_13, L_16, NULL);
+		UnityAction_1_Invoke_m5A664E7E7EB4C9C10661F12DFFB214DF00DD5A8B_inline(L_13, L_14, NULL);
 	}
 
 IL_0052:
 	{
-		int32_t L_17 = V_1;
-		V_1 = ((int32_t)il2cpp_codegen_add(L_17, 1));
+		int32_t L_15 = V_1;
+		V_1 = ((int32_t)il2cpp_codegen_add(L_15, 1));
 	}
 
 IL_0056:
 	{
-		int32_t L_18 = V_1;
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_19 = V_0;
-		NullCheck(L_19);
-		int32_t L_20;
-		L_20 = List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_inline(L_19, List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_RuntimeMethod_var);
-		if ((((int32_t)L_18) < ((int32_t)L_20)))
+		int32_t L_16 = V_1;
+		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_17 = V_0;
+		NullCheck(L_17);
+		int32_t L_18;
+		L_18 = List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_inline(L_17, List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_RuntimeMethod_var);
+		if ((((int32_t)L_16) < ((int32_t)L_18)))
 		{
 			goto IL_0037;
 		}
@@ -20852,91 +20849,78 @@ IL_0056:
 
 IL_0063:
 	{
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_21 = V_0;
-		int32_t L_22 = V_2;
-		NullCheck(L_21);
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_23;
-		L_23 = List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E(L_21, L_22, List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E_RuntimeMethod_var);
-		if (((RuntimeObject*)IsInst((RuntimeObject*)L_23, ILayoutSelfController_t0E526AE7F9329BA48E86991F8BBC2C0F6C406CA3_il2cpp_TypeInfo_var)))
+		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_19 = V_0;
+		int32_t L_20 = V_2;
+		NullCheck(L_19);
+		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_21;
+		L_21 = List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E(L_19, L_20, List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E_RuntimeMethod_var);
+		V_3 = L_21;
+		if (((RuntimeObject*)IsInst((RuntimeObject*)L_21, ILayoutSelfController_t0E526AE7F9329BA48E86991F8BBC2C0F6C406CA3_il2cpp_TypeInfo_var)))
 		{
 			goto IL_00b8;
 		}
 	}
 	{
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_24 = V_0;
-		int32_t L_25 = V_2;
-		NullCheck(L_24);
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_26;
-		L_26 = List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E(L_24, L_25, List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E_RuntimeMethod_var);
-		V_3 = L_26;
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_27 = V_3;
+		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_22 = V_3;
 		il2cpp_codegen_runtime_class_init_inline(Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C_il2cpp_TypeInfo_var);
-		bool L_28;
-		L_28 = Object_op_Implicit_m93896EF7D68FA113C42D3FE2BC6F661FC7EF514A(L_27, NULL);
-		if (!L_28)
+		bool L_23;
+		L_23 = Object_op_Implicit_m93896EF7D68FA113C42D3FE2BC6F661FC7EF514A(L_22, NULL);
+		if (!L_23)
 		{
 			goto IL_00ab;
 		}
 	}
 	{
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_29 = V_3;
-		if (!((ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E*)IsInstClass((RuntimeObject*)L_29, ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E_il2cpp_TypeInfo_var)))
+		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_24 = V_3;
+		if (!((ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E*)IsInstClass((RuntimeObject*)L_24, ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E_il2cpp_TypeInfo_var)))
 		{
 			goto IL_00ab;
 		}
 	}
 	{
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_30 = V_3;
-		NullCheck(((ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E*)CastclassClass((RuntimeObject*)L_30, ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E_il2cpp_TypeInfo_var)));
-		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_31;
-		L_31 = ScrollRect_get_content_m7878BCA28A96B7FBA02DC466A1ED2C9E191C6996_inline(((ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E*)CastclassClass((RuntimeObject*)L_30, ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E_il2cpp_TypeInfo_var)), NULL);
-		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_32 = ___0_rect;
+		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_25 = V_3;
+		NullCheck(((ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E*)CastclassClass((RuntimeObject*)L_25, ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E_il2cpp_TypeInfo_var)));
+		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_26;
+		L_26 = ScrollRect_get_content_m7878BCA28A96B7FBA02DC466A1ED2C9E191C6996_inline(((ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E*)CastclassClass((RuntimeObject*)L_25, ScrollRect_t17D2F2939CA8953110180DF53164CFC3DC88D70E_il2cpp_TypeInfo_var)), NULL);
+		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_27 = ___0_rect;
 		il2cpp_codegen_runtime_class_init_inline(Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C_il2cpp_TypeInfo_var);
-		bool L_33;
-		L_33 = Object_op_Inequality_mD0BE578448EAA61948F25C32F8DD55AB1F778602(L_31, L_32, NULL);
-		if (!L_33)
+		bool L_28;
+		L_28 = Object_op_Inequality_mD0BE578448EAA61948F25C32F8DD55AB1F778602(L_26, L_27, NULL);
+		if (!L_28)
 		{
 			goto IL_00b8;
 		}
 	}
 	{
-		UnityAction_1_t08643BD289D9DD7E6CD60BA4721F56BE50AF56E7* L_34 = ___1_action;
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_35 = V_0;
-		int32_t L_36 = V_2;
-		NullCheck(L_35);
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_37;
-		L_37 = List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E(L_35, L_36, List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E_RuntimeMethod_var);
-		NullCheck(L_34);
-		UnityAction_1_Invoke_m5A664E7E7EB4C9C10661F12DFFB214DF00DD5A8B_inline(L_34, L_37, NULL);
+		UnityAction_1_t08643BD289D9DD7E6CD60BA4721F56BE50AF56E7* L_29 = ___1_action;
+		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_30 = V_3;
+		NullCheck(L_29);
+		UnityAction_1_Invoke_m5A664E7E7EB4C9C10661F12DFFB214DF00DD5A8B_inline(L_29, L_30, NULL);
 		goto IL_00b8;
 	}
 
 IL_00ab:
 	{
-		UnityAction_1_t08643BD289D9DD7E6CD60BA4721F56BE50AF56E7* L_38 = ___1_action;
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_39 = V_0;
-		int32_t L_40 = V_2;
-		NullCheck(L_39);
-		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_41;
-		L_41 = List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E(L_39, L_40, List_1_get_Item_m20568C4E9C1A6EA9AB25A9DE601FC55AE369A75E_RuntimeMethod_var);
-		NullCheck(L_38);
-		UnityAction_1_Invoke_m5A664E7E7EB4C9C10661F12DFFB214DF00DD5A8B_inline(L_38, L_41, NULL);
+		UnityAction_1_t08643BD289D9DD7E6CD60BA4721F56BE50AF56E7* L_31 = ___1_action;
+		Component_t39FBE53E5EFCF4409111FB22C15FF73717632EC3* L_32 = V_3;
+		NullCheck(L_31);
+		UnityAction_1_Invoke_m5A664E7E7EB4C9C10661F12DFFB214DF00DD5A8B_inline(L_31, L_32, NULL);
 	}
 
 IL_00b8:
 	{
-		int32_t L_42 = V_2;
-		V_2 = ((int32_t)il2cpp_codegen_add(L_42, 1));
+		int32_t L_33 = V_2;
+		V_2 = ((int32_t)il2cpp_codegen_add(L_33, 1));
 	}
 
 IL_00bc:
 	{
-		int32_t L_43 = V_2;
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_44 = V_0;
-		NullCheck(L_44);
-		int32_t L_45;
-		L_45 = List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_inline(L_44, List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_RuntimeMethod_var);
-		if ((((int32_t)L_43) < ((int32_t)L_45)))
+		int32_t L_34 = V_2;
+		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_35 = V_0;
+		NullCheck(L_35);
+		int32_t L_36;
+		L_36 = List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_inline(L_35, List_1_get_Count_m06EAEA52AB075AB3B80E493CE0593C177AB19727_RuntimeMethod_var);
+		if ((((int32_t)L_34) < ((int32_t)L_36)))
 		{
 			goto IL_0063;
 		}
@@ -20948,25 +20932,25 @@ IL_00bc:
 
 IL_00ca:
 	{
-		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_46 = ___0_rect;
-		int32_t L_47 = V_4;
-		NullCheck(L_46);
-		Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* L_48;
-		L_48 = Transform_GetChild_mE686DF0C7AAC1F7AEF356967B1C04D8B8E240EAF(L_46, L_47, NULL);
-		UnityAction_1_t08643BD289D9DD7E6CD60BA4721F56BE50AF56E7* L_49 = ___1_action;
-		LayoutRebuilder_PerformLayoutControl_mA6EB813FBAC300966A6357D248FAADD947C92D4B(__this, ((RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5*)IsInstSealed((RuntimeObject*)L_48, RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5_il2cpp_TypeInfo_var)), L_49, NULL);
-		int32_t L_50 = V_4;
-		V_4 = ((int32_t)il2cpp_codegen_add(L_50, 1));
+		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_37 = ___0_rect;
+		int32_t L_38 = V_4;
+		NullCheck(L_37);
+		Transform_tB27202C6F4E36D225EE28A13E4D662BF99785DB1* L_39;
+		L_39 = Transform_GetChild_mE686DF0C7AAC1F7AEF356967B1C04D8B8E240EAF(L_37, L_38, NULL);
+		UnityAction_1_t08643BD289D9DD7E6CD60BA4721F56BE50AF56E7* L_40 = ___1_action;
+		LayoutRebuilder_PerformLayoutControl_mA6EB813FBAC300966A6357D248FAADD947C92D4B(__this, ((RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5*)IsInstSealed((RuntimeObject*)L_39, RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5_il2cpp_TypeInfo_var)), L_40, NULL);
+		int32_t L_41 = V_4;
+		V_4 = ((int32_t)il2cpp_codegen_add(L_41, 1));
 	}
 
 IL_00e4:
 	{
-		int32_t L_51 = V_4;
-		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_52 = ___0_rect;
-		NullCheck(L_52);
-		int32_t L_53;
-		L_53 = Transform_get_childCount_mE9C29C702AB662CC540CA053EDE48BDAFA35B4B0(L_52, NULL);
-		if ((((int32_t)L_51) < ((int32_t)L_53)))
+		int32_t L_42 = V_4;
+		RectTransform_t6C5DA5E41A89E0F488B001E45E58963480E543A5* L_43 = ___0_rect;
+		NullCheck(L_43);
+		int32_t L_44;
+		L_44 = Transform_get_childCount_mE9C29C702AB662CC540CA053EDE48BDAFA35B4B0(L_43, NULL);
+		if ((((int32_t)L_42) < ((int32_t)L_44)))
 		{
 			goto IL_00ca;
 		}
@@ -20974,9 +20958,9 @@ IL_00e4:
 
 IL_00ee:
 	{
-		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_54 = V_0;
+		List_1_t584CB490C8F4C21E0A0D5545409ED60BF71F3FE4* L_45 = V_0;
 		il2cpp_codegen_runtime_class_init_inline(CollectionPool_2_t108CF9D9B2C4D978FA47DCA328A90221D356C6ED_il2cpp_TypeInfo_var);
-		CollectionPool_2_Release_m59C1324B0736F8E08B4D90A0C1C63768047F9E4C(L_54, CollectionPool_2_Release_m59C1324B0736F8E08B4D90A0C1C63768047F9E4C_RuntimeMethod_var);
+		CollectionPool_2_Release_m59C1324B0736F8E08B4D90A0C1C63768047F9E4C(L_45, CollectionPool_2_Release_m59C1324B0736F8E08B4D90A0C1C63768047F9E4C_RuntimeMethod_var);
 		return;
 	}
 }
@@ -23416,9 +23400,11 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void MaskableGraphic_UpdateCull_mAC0798E6376F
 		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&_stringLiteral0BB6A54C48827D7DFD66BED24353A0F8912C3BFE);
 		s_Il2CppMethodInitialized = true;
 	}
+	CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* V_0 = NULL;
 	{
 		CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* L_0;
 		L_0 = Graphic_get_canvasRenderer_m62AB727277A28728264860232642DA6EC20DEAB1(__this, NULL);
+		V_0 = L_0;
 		NullCheck(L_0);
 		bool L_1;
 		L_1 = CanvasRenderer_get_cull_m48007D7CB40B3C0EC29F0CB316AFAC88748EF3D7(L_0, NULL);
@@ -23429,8 +23415,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void MaskableGraphic_UpdateCull_mAC0798E6376F
 		}
 	}
 	{
-		CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* L_3;
-		L_3 = Graphic_get_canvasRenderer_m62AB727277A28728264860232642DA6EC20DEAB1(__this, NULL);
+		CanvasRenderer_tAB9A55A976C4E3B2B37D0CE5616E5685A8B43860* L_3 = V_0;
 		bool L_4 = ___0_cull;
 		NullCheck(L_3);
 		CanvasRenderer_set_cull_mA2A521F41185511CCFF6E2BFCD7B68B1DE3C0D9D(L_3, L_4, NULL);
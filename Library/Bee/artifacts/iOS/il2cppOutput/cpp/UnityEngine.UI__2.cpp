@@ -5303,10 +5303,12 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void RectMask2D_PerformClipping_mD89C9AEAC139
 	Enumerator_t22A03C5689C82B1FD364D904EAB5423B8E4D5B3A V_4;
 	memset((&V_4), 0, sizeof(V_4));
 	MaskableGraphic_tFC5B6BE351C90DE53744DF2A70940242774B361E* V_5 = NULL;
+	Canvas_t2DB4CEFDFF732884866C83F11ABF75F5AE8FFB26* V_6 = NULL;
 	int32_t G_B8_0 = 0;
 	{
 		Canvas_t2DB4CEFDFF732884866C83F11ABF75F5AE8FFB26* L_0;
 		L_0 = RectMask2D_get_Canvas_m689A6760F58FD683B7A5EA6A92691AAA521D4634(__this, NULL);
+		V_6 = L_0;
 		if (L_0)
 		{
 			goto IL_0009;
@@ -5337,8 +5339,7 @@ IL_0024:
 		Rect_tA04E0F8A1830E767F40FB27ECD8D309303571F0D L_4;
 		L_4 = Clipping_FindCullAndClipWorldRect_mE367B99A2BEBA67F6B394B7E95346C9F6416C4B5(L_3, (&V_0), NULL);
 		V_1 = L_4;
-		Canvas_t2DB4CEFDFF732884866C83F11ABF75F5AE8FFB26* L_5;
-		L_5 = RectMask2D_get_Canvas_m689A6760F58FD683B7A5EA6A92691AAA521D4634(__this, NULL);
+		Canvas_t2DB4CEFDFF732884866C83F11ABF75F5AE8FFB26* L_5 = V_6;
 		NullCheck(L_5);
 		Canvas_t2DB4CEFDFF732884866C83F11ABF75F5AE8FFB26* L_6;
 		L_6 = Canvas_get_rootCanvas_m74DEA02014963B54DF651BE14284BDAFDA61DDFE(L_5, NULL);
@@ -22348,17 +22349,19 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void VertexHelper_AddTriangle_mBA2504734E550C
 		il2cpp_codegen_initialize_runtime_metadata((uintptr_t*)&List_1_Add_m0248A96C5334E9A93E6994B7780478BCD994EA3D_RuntimeMethod_var);
 		s_Il2CppMethodInitialized = true;
 	}
+	List_1_t05915E9237850A58106982B7FE4BC5DA4E872E73* V_0 = NULL;
 	{
 		VertexHelper_InitializeListIfRequired_mC7180B010A6DCC7C1115A33D29B8E00B92DB2542(__this, NULL);
 		List_1_t05915E9237850A58106982B7FE4BC5DA4E872E73* L_0 = __this->___m_Indices;
+		V_0 = L_0;
 		int32_t L_1 = ___0_idx0;
 		NullCheck(L_0);
 		List_1_Add_m0248A96C5334E9A93E6994B7780478BCD994EA3D_inline(L_0, L_1, List_1_Add_m0248A96C5334E9A93E6994B7780478BCD994EA3D_RuntimeMethod_var);
-		List_1_t05915E9237850A58106982B7FE4BC5DA4E872E73* L_2 = __this->___m_Indices;
+		List_1_t05915E9237850A58106982B7FE4BC5DA4E872E73* L_2 = V_0;
 		int32_t L_3 = ___1_idx1;
 		NullCheck(L_2);
 		List_1_Add_m0248A96C5334E9A93E6994B7780478BCD994EA3D_inline(L_2, L_3, List_1_Add_m0248A96C5334E9A93E6994B7780478BCD994EA3D_RuntimeMethod_var);
-		List_1_t05915E9237850A58106982B7FE4BC5DA4E872E73* L_4 = __this->___m_Indices;
+		List_1_t05915E9237850A58106982B7FE4BC5DA4E872E73* L_4 = V_0;
 		int32_t L_5 = ___2_idx2;
 		NullCheck(L_4);
 		List_1_Add_m0248A96C5334E9A93E6994B7780478BCD994EA3D_inline(L_4, L_5, List_1_Add_m0248A96C5334E9A93E6994B7780478BCD994EA3D_RuntimeMethod_var);
@@ -22369,6 +22372,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void VertexHelper_AddUIVertexQuad_m6AC21081F2
 {
 	int32_t V_0 = 0;
 	int32_t V_1 = 0;
+	UIVertex_tF5C663F4BBC786C9D56C28016FF66E6C6BF85207* V_2 = NULL;
 	{
 		int32_t L_0;
 		L_0 = VertexHelper_get_currentVertCount_m45BFEBD6FCB7DF3BF9F76946D6002BDC58B173A4(__this, NULL);
@@ -22382,49 +22386,35 @@ IL_000b:
 		UIVertexU5BU5D_tBC532486B45D071A520751A90E819C77BA4E3D2F* L_1 = ___0_verts;
 		int32_t L_2 = V_1;
 		NullCheck(L_1);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_3 = ((L_1)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_2)))->___position;
-		UIVertexU5BU5D_tBC532486B45D071A520751A90E819C77BA4E3D2F* L_4 = ___0_verts;
-		int32_t L_5 = V_1;
-		NullCheck(L_4);
-		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_6 = ((L_4)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_5)))->___color;
-		UIVertexU5BU5D_tBC532486B45D071A520751A90E819C77BA4E3D2F* L_7 = ___0_verts;
-		int32_t L_8 = V_1;
-		NullCheck(L_7);
-		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_9 = ((L_7)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_8)))->___uv0;
-		UIVertexU5BU5D_tBC532486B45D071A520751A90E819C77BA4E3D2F* L_10 = ___0_verts;
-		int32_t L_11 = V_1;
-		NullCheck(L_10);
-		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_12 = ((L_10)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_11)))->___uv1;
-		UIVertexU5BU5D_tBC532486B45D071A520751A90E819C77BA4E3D2F* L_13 = ___0_verts;
-		int32_t L_14 = V_1;
-		NullCheck(L_13);
-		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_15 = ((L_13)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_14)))->___normal;
-		UIVertexU5BU5D_tBC532486B45D071A520751A90E819C77BA4E3D2F* L_16 = ___0_verts;
-		int32_t L_17 = V_1;
-		NullCheck(L_16);
-		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_18 = ((L_16)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_17)))->___tangent;
-		VertexHelper_AddVert_m5765AC8F13C86709B2EFEC613D492963BE1E1198(__this, L_3, L_6, L_9, L_12, L_15, L_18, NULL);
-		int32_t L_19 = V_1;
-		V_1 = ((int32_t)il2cpp_codegen_add(L_19, 1));
+		V_2 = ((L_1)->GetAddressAt(static_cast<il2cpp_array_size_t>(L_2)));
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_3 = V_2->___position;
+		Color32_t73C5004937BF5BB8AD55323D51AAA40A898EF48B L_4 = V_2->___color;
+		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_5 = V_2->___uv0;
+		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_6 = V_2->___uv1;
+		Vector3_t24C512C7B96BBABAD472002D0BA2BDA40A5A80B2 L_7 = V_2->___normal;
+		Vector4_t58B63D32F48C0DBF50DE2C60794C4676C80EDBE3 L_8 = V_2->___tangent;
+		VertexHelper_AddVert_m5765AC8F13C86709B2EFEC613D492963BE1E1198(__this, L_3, L_4, L_5, L_6, L_7, L_8, NULL);
+		int32_t L_9 = V_1;
+		V_1 = ((int32_t)il2cpp_codegen_add(L_9, 1));
 	}
 
 IL_005d:
 	{
-		int32_t L_20 = V_1;
-		if ((((int32_t)L_20) < ((int32_t)4)))
+		int32_t L_10 = V_1;
+		if ((((int32_t)L_10) < ((int32_t)4)))
 		{
 			goto IL_000b;
 		}
 	}
 	{
-		int32_t L_21 = V_0;
-		int32_t L_22 = V_0;
-		int32_t L_23 = V_0;
-		VertexHelper_AddTriangle_mBA2504734E550C672A33168BE119D76D92C788A4(__this, L_21, ((int32_t)il2cpp_codegen_add(L_22, 1)), ((int32_t)il2cpp_codegen_add(L_23, 2)), NULL);
-		int32_t L_24 = V_0;
-		int32_t L_25 = V_0;
-		int32_t L_26 = V_0;
-		VertexHelper_AddTriangle_mBA2504734E550C672A33168BE119D76D92C788A4(__this, ((int32_t)il2cpp_codegen_add(L_24, 2)), ((int32_t)il2cpp_codegen_add(L_25, 3)), L_26, NULL);
+		int32_t L_11 = V_0;
+		int32_t L_12 = V_0;
+		int32_t L_13 = V_0;
+		VertexHelper_AddTriangle_mBA2504734E550C672A33168BE119D76D92C788A4(__this, L_11, ((int32_t)il2cpp_codegen_add(L_12, 1)), ((int32_t)il2cpp_codegen_add(L_13, 2)), NULL);
+		int32_t L_14 = V_0;
+		int32_t L_15 = V_0;
+		int32_t L_16 = V_0;
+		VertexHelper_AddTriangle_mBA2504734E550C672A33168BE119D76D92C788A4(__this, ((int32_t)il2cpp_codegen_add(L_14, 2)), ((int32_t)il2cpp_codegen_add(L_15, 3)), L_16, NULL);
 		return;
 	}
 }
@@ -11944,6 +11944,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void EventSystem_TickModules_mD3F159C0C33396B
 	}
 	int32_t V_0 = 0;
 	int32_t V_1 = 0;
+	BaseInputModule_tF3B7C22AF1419B2AC9ECE6589357DC1B88ED96B1* V_2 = NULL;
 	{
 		List_1_tA5BDE435C735A082941CD33D212F97F4AE9FA55F* L_0 = __this->___m_SystemInputModules;
 		NullCheck(L_0);
@@ -11961,6 +11962,7 @@ IL_0010:
 		NullCheck(L_2);
 		BaseInputModule_tF3B7C22AF1419B2AC9ECE6589357DC1B88ED96B1* L_4;
 		L_4 = List_1_get_Item_mACF1100B04593A3900794607D59A4024DBD118B6(L_2, L_3, List_1_get_Item_mACF1100B04593A3900794607D59A4024DBD118B6_RuntimeMethod_var);
+		V_2 = L_4;
 		il2cpp_codegen_runtime_class_init_inline(Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C_il2cpp_TypeInfo_var);
 		bool L_5;
 		L_5 = Object_op_Inequality_mD0BE578448EAA61948F25C32F8DD55AB1F778602(L_4, (Object_tC12DECB6760A7F2CBF65D9DCF18D044C2D97152C*)NULL, NULL);
@@ -11970,26 +11972,22 @@ IL_0010:
 		}
 	}
 	{
-		List_1_tA5BDE435C735A082941CD33D212F97F4AE9FA55F* L_6 = __this->___m_SystemInputModules;
-		int32_t L_7 = V_1;
+		BaseInputModule_tF3B7C22AF1419B2AC9ECE6589357DC1B88ED96B1* L_6 = V_2;
 		NullCheck(L_6);
-		BaseInputModule_tF3B7C22AF1419B2AC9ECE6589357DC1B88ED96B1* L_8;
-		L_8 = List_1_get_Item_mACF1100B04593A3900794607D59A4024DBD118B6(L_6, L_7, List_1_get_Item_mACF1100B04593A3900794607D59A4024DBD118B6_RuntimeMethod_var);
-		NullCheck(L_8);
-		VirtualActionInvoker0::Invoke(24, L_8);
+		VirtualActionInvoker0::Invoke(24, L_6);
 	}
 
 IL_0035:
 	{
-		int32_t L_9 = V_1;
-		V_1 = ((int32_t)il2cpp_codegen_add(L_9, 1));
+		int32_t L_7 = V_1;
+		V_1 = ((int32_t)il2cpp_codegen_add(L_7, 1));
 	}
 
 IL_0039:
 	{
-		int32_t L_10 = V_1;
-		int32_t L_11 = V_0;
-		if ((((int32_t)L_10) < ((int32_t)L_11)))
+		int32_t L_8 = V_1;
+		int32_t L_9 = V_0;
+		if ((((int32_t)L_8) < ((int32_t)L_9)))
 		{
 			goto IL_0010;
 		}